@@ -0,0 +1,684 @@
+#include <BaseCoder/Base58.hpp>
+#include <BaseCoder/Base85.hpp>
+#include <BaseCoder/BaseCoder.hpp>
+#include <BaseCoder/Batch.hpp>
+#include <BaseCoder/Lines.hpp>
+#include <BaseCoder/Parallel.hpp>
+#include <BaseCoder/Ranges.hpp>
+#include <BaseCoder/Transcode.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace base_coder;
+
+constexpr int64_t minimalSize = 8;
+constexpr int64_t maximalSize = int64_t{ 64 } << 20;
+constexpr int64_t maximalListSize = int64_t{ 1 } << 20;
+
+///
+/// \brief makeData
+/// \tparam Container
+/// \param size
+/// \return container with random bytes
+///
+template<typename Container>
+Container makeData(size_t size)
+{
+	std::mt19937 generator(size);
+	Container container;
+	for (size_t i = 0; i != size; ++i)
+	{
+		container.push_back(static_cast<typename Container::value_type>(generator()));
+	}
+	return container;
+}
+
+///
+/// \brief makeEncoded
+/// \tparam Coder
+/// \tparam Container
+/// \param size count of bytes before encoding
+/// \return container with encoded random bytes
+///
+template<typename Coder, typename Container>
+Container makeEncoded(size_t size)
+{
+	const Coder coder;
+	const auto data = makeData<std::vector<std::uint8_t>>(size);
+	Container encoded;
+	coder.encode(data, std::back_inserter(encoded));
+	return encoded;
+}
+
+void sizes(benchmark::internal::Benchmark *benchmark)
+{
+	benchmark->RangeMultiplier(8)->Range(minimalSize, maximalSize);
+}
+
+void listSizes(benchmark::internal::Benchmark *benchmark)
+{
+	benchmark->RangeMultiplier(8)->Range(minimalSize, maximalListSize);
+}
+
+void levels(benchmark::internal::Benchmark *benchmark)
+{
+	benchmark->ArgsProduct({
+		benchmark::CreateRange(minimalSize, maximalSize, 64)
+		, { static_cast<int64_t>(SimdLevel::Scalar), static_cast<int64_t>(SimdLevel::Ssse3)
+			, static_cast<int64_t>(SimdLevel::Avx2), static_cast<int64_t>(SimdLevel::Avx512)
+			, static_cast<int64_t>(SimdLevel::Avx512Vbmi) }
+	});
+}
+
+void threads(benchmark::internal::Benchmark *benchmark)
+{
+	// 192 KiB is a chunk of the command line tool
+	benchmark->ArgsProduct({ { int64_t{ 192 } << 10, int64_t{ 16 } << 20 }, { 1, 2, 4 } })
+			->UseRealTime();
+}
+
+void tokens(benchmark::internal::Benchmark *benchmark)
+{
+	benchmark->Arg(16)->Arg(32)->Arg(64);
+}
+
+///
+/// \brief The LevelGuard class: sets SIMD level from benchmark argument
+///
+class LevelGuard
+{
+public:
+	explicit LevelGuard(benchmark::State &state)
+			: supported{ setSimdLevel(static_cast<SimdLevel>(state.range(1))) }
+	{
+		if (!supported)
+		{
+			state.SkipWithError("SIMD level isn't supported");
+		}
+	}
+
+	~LevelGuard()
+	{
+		setSimdLevel(detectSimdLevel());
+	}
+
+	bool supported; ///<
+};
+
+// iterator API
+
+template<typename Coder, typename Container>
+void encode(benchmark::State &state)
+{
+	const Coder coder;
+	const auto data = makeData<Container>(state.range(0));
+	std::string out;
+	out.reserve(coder.encodeSize(data));
+	for (auto _ : state)
+	{
+		out.clear();
+		coder.encode(data, std::back_inserter(out));
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Coder, typename Container>
+void decode(benchmark::State &state)
+{
+	const Coder coder;
+	const auto encoded = makeEncoded<Coder, Container>(state.range(0));
+	std::vector<std::uint8_t> out;
+	out.reserve(state.range(0));
+	for (auto _ : state)
+	{
+		out.clear();
+		coder.decode(encoded, std::back_inserter(out));
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+
+// contiguous API
+
+template<typename Coder>
+void encodeContiguous(benchmark::State &state)
+{
+	const LevelGuard guard(state);
+	const Coder coder;
+	const auto data = makeData<std::vector<std::uint8_t>>(state.range(0));
+	std::string out(coder.encodeSize(data), '\0');
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(coder.encode(data.data(), data.size(), out.data()));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Coder>
+void decodeContiguous(benchmark::State &state)
+{
+	const LevelGuard guard(state);
+	const Coder coder;
+	const auto encoded = makeEncoded<Coder, std::string>(state.range(0));
+	std::vector<std::uint8_t> out(state.range(0));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(coder.decode(encoded.data(), encoded.size(), out.data()));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+
+template<typename Coder>
+void validate(benchmark::State &state)
+{
+	const LevelGuard guard(state);
+	const Coder coder;
+	const auto encoded = makeEncoded<Coder, std::string>(state.range(0));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(coder.validate(encoded.data(), encoded.size()));
+	}
+	state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+
+template<typename Coder>
+void decodeChecked(benchmark::State &state)
+{
+	const LevelGuard guard(state);
+	const Coder coder;
+	const auto encoded = makeEncoded<Coder, std::string>(state.range(0));
+	std::vector<std::uint8_t> out(state.range(0));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(coder.decodeChecked(encoded.data(), encoded.size()
+				, out.data()));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+
+// threads
+
+///
+/// \brief parallelOptions
+/// \param state
+/// \return options with thread count from benchmark argument, small inputs are split too
+///
+ParallelOptions parallelOptions(const benchmark::State &state)
+{
+	ParallelOptions options;
+	options.threadCount = static_cast<std::size_t>(state.range(1));
+	options.minimalSize = 0;
+	options.minimalPartSize = std::size_t{ 16 } << 10;
+	return options;
+}
+
+template<typename Trait>
+void encodeParallel(benchmark::State &state)
+{
+	const ParallelOptions options = parallelOptions(state);
+	const auto data = makeData<std::vector<std::uint8_t>>(state.range(0));
+	std::string out(BaseCoder<Trait>{}.encodeSize(data), '\0');
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(parallelEncode<Trait>(data.data(), data.size(), out.data()
+				, options));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Trait>
+void decodeParallel(benchmark::State &state)
+{
+	const ParallelOptions options = parallelOptions(state);
+	const auto encoded = makeEncoded<BaseCoder<Trait>, std::string>(state.range(0));
+	std::vector<std::uint8_t> out(state.range(0));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(parallelDecode<Trait>(encoded.data(), encoded.size()
+				, out.data(), options));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+
+// MIME lines
+
+template<typename Trait>
+void encodeLines(benchmark::State &state)
+{
+	const LevelGuard guard(state);
+	const LineCoder<Trait> coder(mimeLines);
+	const auto data = makeData<std::vector<std::uint8_t>>(state.range(0));
+	std::string out(coder.encodeSize(data.size()), '\0');
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(coder.encode(data.data(), data.size(), out.data()));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Trait>
+void decodeLines(benchmark::State &state)
+{
+	const LevelGuard guard(state);
+	const LineCoder<Trait> coder(mimeLines);
+	const auto data = makeData<std::vector<std::uint8_t>>(state.range(0));
+	std::string encoded(coder.encodeSize(data.size()), '\0');
+	coder.encode(data.data(), data.size(), encoded.data());
+	std::vector<std::uint8_t> out(coder.upperBoundDecodeSize(encoded.size()));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(coder.decode(encoded.data(), encoded.size(), out.data()));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+
+// many short tokens
+
+constexpr size_t tokenCount = 10000;
+
+template<typename Coder>
+void encodeTokensLoop(benchmark::State &state)
+{
+	const Coder coder;
+	std::vector<std::string> inputs(tokenCount);
+	for (auto &input : inputs)
+	{
+		input = makeData<std::string>(state.range(0));
+	}
+	for (auto _ : state)
+	{
+		for (const auto &input : inputs)
+		{
+			std::string out;
+			coder.encode(input, std::back_inserter(out));
+			benchmark::DoNotOptimize(out.data());
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * tokenCount);
+	state.SetBytesProcessed(state.iterations() * tokenCount * state.range(0));
+}
+
+template<typename Trait>
+void encodeTokensBatch(benchmark::State &state)
+{
+	std::vector<std::string> inputs(tokenCount);
+	for (auto &input : inputs)
+	{
+		input = makeData<std::string>(state.range(0));
+	}
+	std::string arena(encodeBatchSize<Trait>(inputs), '\0');
+	std::vector<size_t> offsets(inputs.size() + 1);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(encodeBatch<Trait>(inputs, arena.data(), offsets.data()));
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * tokenCount);
+	state.SetBytesProcessed(state.iterations() * tokenCount * state.range(0));
+}
+
+template<typename Coder>
+void decodeTokensLoop(benchmark::State &state)
+{
+	std::vector<std::string> inputs(tokenCount);
+	for (auto &input : inputs)
+	{
+		input = makeEncoded<Coder, std::string>(state.range(0));
+	}
+	const Coder coder;
+	for (auto _ : state)
+	{
+		for (const auto &input : inputs)
+		{
+			std::vector<std::uint8_t> out;
+			coder.decode(input, std::back_inserter(out));
+			benchmark::DoNotOptimize(out.data());
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * tokenCount);
+	state.SetBytesProcessed(state.iterations() * tokenCount * state.range(0));
+}
+
+template<typename Trait>
+void decodeTokensBatch(benchmark::State &state)
+{
+	std::vector<std::string> inputs(tokenCount);
+	for (auto &input : inputs)
+	{
+		input = makeEncoded<BaseCoder<Trait>, std::string>(state.range(0));
+	}
+	std::vector<std::uint8_t> arena(decodeBatchSize<Trait>(inputs));
+	std::vector<size_t> offsets(inputs.size() + 1);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(decodeBatch<Trait>(inputs, arena.data(), offsets.data()));
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * tokenCount);
+	state.SetBytesProcessed(state.iterations() * tokenCount * state.range(0));
+}
+
+template<typename FromTrait, typename ToTrait>
+void transcode(benchmark::State &state)
+{
+	const LevelGuard guard(state);
+	const auto data = makeData<std::vector<std::uint8_t>>(state.range(0));
+	std::string encoded;
+	BaseCoder<FromTrait>{}.encode(data, std::back_inserter(encoded));
+	std::string out(upperBoundTranscodeSize<FromTrait, ToTrait>(encoded.size()), '\0');
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(base_coder::transcode<FromTrait, ToTrait>(encoded.data()
+				, encoded.size(), out.data()));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+
+///
+/// \brief transcodeBuffered: decoding to temporary vector and encoding it
+///
+template<typename FromTrait, typename ToTrait>
+void transcodeBuffered(benchmark::State &state)
+{
+	const LevelGuard guard(state);
+	const auto data = makeData<std::vector<std::uint8_t>>(state.range(0));
+	std::string encoded;
+	BaseCoder<FromTrait>{}.encode(data, std::back_inserter(encoded));
+	std::string out(upperBoundTranscodeSize<FromTrait, ToTrait>(encoded.size()), '\0');
+	for (auto _ : state)
+	{
+		std::vector<std::uint8_t> decoded(BaseCoder<FromTrait>::upperBoundDecodeSize(
+				encoded.size()));
+		const DecodeResult result = BaseCoder<FromTrait>{}.decodeChecked(encoded.data()
+				, encoded.size(), decoded.data());
+		benchmark::DoNotOptimize(BaseCoder<ToTrait>{}.encode(decoded.data(), result.written
+				, out.data()));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+
+// Base58 of hashes
+
+///
+/// \brief naiveBase58Encode: usual division of the whole number by 58 for each byte
+/// \param input
+/// \param size count of bytes, not greater than 256
+/// \param output
+/// \return count of written characters
+///
+size_t naiveBase58Encode(const std::uint8_t *input, size_t size, char *output)
+{
+	size_t zeros = 0;
+	for (; zeros != size && input[zeros] == 0; ++zeros)
+	{
+		output[zeros] = Base58::alphabet[0];
+	}
+	std::uint8_t digits[352];
+	size_t length = 0;
+	for (size_t i = zeros; i != size; ++i)
+	{
+		unsigned carry = input[i];
+		for (size_t j = 0; j != length; ++j)
+		{
+			carry += static_cast<unsigned>(digits[j]) << 8;
+			digits[j] = static_cast<std::uint8_t>(carry % 58);
+			carry /= 58;
+		}
+		for (; carry; carry /= 58)
+		{
+			digits[length++] = static_cast<std::uint8_t>(carry % 58);
+		}
+	}
+	for (size_t i = 0; i != length; ++i)
+	{
+		output[zeros + i] = Base58::alphabet[digits[length - i - 1]];
+	}
+	return zeros + length;
+}
+
+///
+/// \brief naiveBase58Decode: usual multiplication of the whole number by 58 for
+/// each character
+/// \param input valid characters
+/// \param size count of characters, not greater than 352
+/// \param output
+/// \return count of written bytes
+///
+size_t naiveBase58Decode(const char *input, size_t size, std::uint8_t *output)
+{
+	size_t zeros = 0;
+	for (; zeros != size && input[zeros] == Base58::alphabet[0]; ++zeros)
+	{
+		output[zeros] = 0;
+	}
+	std::uint8_t bytes[352];
+	size_t length = 0;
+	for (size_t i = zeros; i != size; ++i)
+	{
+		unsigned carry = Base58::reverseAlphabet[static_cast<std::uint8_t>(input[i])];
+		for (size_t j = 0; j != length; ++j)
+		{
+			carry += static_cast<unsigned>(bytes[j]) * 58;
+			bytes[j] = static_cast<std::uint8_t>(carry);
+			carry >>= 8;
+		}
+		for (; carry; carry >>= 8)
+		{
+			bytes[length++] = static_cast<std::uint8_t>(carry);
+		}
+	}
+	for (size_t i = 0; i != length; ++i)
+	{
+		output[zeros + i] = bytes[length - i - 1];
+	}
+	return zeros + length;
+}
+
+///
+/// \brief makeHashes
+/// \param size count of bytes of each hash
+/// \return tokenCount random hashes
+///
+std::vector<std::vector<std::uint8_t>> makeHashes(size_t size)
+{
+	std::mt19937 generator(58);
+	std::vector<std::vector<std::uint8_t>> hashes(tokenCount, std::vector<std::uint8_t>(size));
+	for (auto &hash : hashes)
+	{
+		for (auto &i : hash)
+		{
+			i = static_cast<std::uint8_t>(generator());
+		}
+	}
+	return hashes;
+}
+
+template<bool NAIVE>
+void base58Encode(benchmark::State &state)
+{
+	const Base58 coder;
+	const auto hashes = makeHashes(state.range(0));
+	std::string out(Base58::upperBoundEncodeSize(state.range(0)), '\0');
+	for (auto _ : state)
+	{
+		for (const auto &hash : hashes)
+		{
+			benchmark::DoNotOptimize(NAIVE
+					? naiveBase58Encode(hash.data(), hash.size(), out.data())
+					: coder.encode(hash.data(), hash.size(), out.data()));
+			benchmark::ClobberMemory();
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * tokenCount);
+	state.SetBytesProcessed(state.iterations() * tokenCount * state.range(0));
+}
+
+template<bool NAIVE>
+void base58Decode(benchmark::State &state)
+{
+	const Base58 coder;
+	std::vector<std::string> inputs;
+	for (const auto &hash : makeHashes(state.range(0)))
+	{
+		inputs.emplace_back();
+		coder.encode(hash, std::back_inserter(inputs.back()));
+	}
+	std::vector<std::uint8_t> out(Base58::upperBoundDecodeSize(
+			Base58::upperBoundEncodeSize(state.range(0))));
+	for (auto _ : state)
+	{
+		for (const auto &input : inputs)
+		{
+			benchmark::DoNotOptimize(NAIVE
+					? naiveBase58Decode(input.data(), input.size(), out.data())
+					: coder.decode(input.data(), input.size(), out.data()));
+			benchmark::ClobberMemory();
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * tokenCount);
+	state.SetBytesProcessed(state.iterations() * tokenCount * state.range(0));
+}
+
+// Base85
+
+template<typename Coder>
+void base85Encode(benchmark::State &state)
+{
+	const Coder coder;
+	const auto data = makeData<std::vector<std::uint8_t>>(state.range(0));
+	std::string out(Coder::upperBoundEncodeSize(data.size()), '\0');
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(coder.encode(data.data(), data.size(), out.data()));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Coder>
+void base85Decode(benchmark::State &state)
+{
+	const LevelGuard guard(state);
+	const Coder coder;
+	std::string encoded;
+	coder.encode(makeData<std::vector<std::uint8_t>>(state.range(0))
+			, std::back_inserter(encoded));
+	std::vector<std::uint8_t> out(Coder::upperBoundDecodeSize(encoded.size()));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(coder.decodeChecked(encoded.data(), encoded.size()
+				, out.data()));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+
+// range views
+
+///
+/// \brief hashEncoded: FNV-1a of encoded characters, from lazy view or from string
+/// \tparam VIEW
+///
+template<bool VIEW>
+void hashEncoded(benchmark::State &state)
+{
+	const auto data = makeData<std::vector<std::uint8_t>>(state.range(0));
+	auto hash = [](auto &&range)
+	{
+		std::uint64_t result = 0xCBF29CE484222325ull;
+		for (char i : range)
+		{
+			result = (result ^ static_cast<std::uint8_t>(i)) * 0x100000001B3ull;
+		}
+		return result;
+	};
+	for (auto _ : state)
+	{
+		if constexpr (VIEW)
+		{
+			benchmark::DoNotOptimize(hash(data | views::encode<Base64>));
+		}
+		else
+		{
+			std::string encoded;
+			Base64{}.encode(data, std::back_inserter(encoded));
+			benchmark::DoNotOptimize(hash(encoded));
+		}
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+#define BASECODER_BENCHMARK(Coder) \
+	BENCHMARK_TEMPLATE(encode, Coder, std::string)->Apply(sizes); \
+	BENCHMARK_TEMPLATE(encode, Coder, std::vector<std::uint8_t>)->Apply(sizes); \
+	BENCHMARK_TEMPLATE(encode, Coder, std::list<char>)->Apply(listSizes); \
+	BENCHMARK_TEMPLATE(decode, Coder, std::string)->Apply(sizes); \
+	BENCHMARK_TEMPLATE(decode, Coder, std::vector<std::uint8_t>)->Apply(sizes); \
+	BENCHMARK_TEMPLATE(decode, Coder, std::list<char>)->Apply(listSizes); \
+	BENCHMARK_TEMPLATE(encodeContiguous, Coder)->Apply(levels); \
+	BENCHMARK_TEMPLATE(decodeContiguous, Coder)->Apply(levels); \
+	BENCHMARK_TEMPLATE(decodeChecked, Coder)->Apply(levels); \
+	BENCHMARK_TEMPLATE(validate, Coder)->Apply(levels)
+
+BASECODER_BENCHMARK(Base64);
+BASECODER_BENCHMARK(Base64Hex);
+BASECODER_BENCHMARK(Base32);
+BASECODER_BENCHMARK(Base32Hex);
+BASECODER_BENCHMARK(Base16);
+BASECODER_BENCHMARK(Base16Lower);
+BASECODER_BENCHMARK(Base32Crockford);
+BASECODER_BENCHMARK(Base64Bcrypt);
+
+BENCHMARK_TEMPLATE(encodeParallel, Base64Traits)->Apply(threads);
+BENCHMARK_TEMPLATE(decodeParallel, Base64Traits)->Apply(threads);
+
+BENCHMARK_TEMPLATE(encodeLines, Base64Traits)->Apply(levels);
+BENCHMARK_TEMPLATE(decodeLines, Base64Traits)->Apply(levels);
+
+BENCHMARK_TEMPLATE(transcode, Base64Traits, Base32Traits)->Apply(levels);
+BENCHMARK_TEMPLATE(transcodeBuffered, Base64Traits, Base32Traits)->Apply(levels);
+BENCHMARK_TEMPLATE(transcode, Base64Traits, Base16LowerTraits)->Apply(levels);
+BENCHMARK_TEMPLATE(transcode, Base64Traits, Base64HexTraits)->Apply(levels);
+BENCHMARK_TEMPLATE(transcode, Base32Traits, Base32HexTraits)->Apply(levels);
+
+BENCHMARK_TEMPLATE(encodeTokensLoop, Base64)->Apply(tokens);
+BENCHMARK_TEMPLATE(encodeTokensBatch, Base64Traits)->Apply(tokens);
+BENCHMARK_TEMPLATE(decodeTokensLoop, Base64)->Apply(tokens);
+BENCHMARK_TEMPLATE(decodeTokensBatch, Base64Traits)->Apply(tokens);
+
+BENCHMARK_TEMPLATE(base58Encode, false)->Arg(32)->Arg(256);
+BENCHMARK_TEMPLATE(base58Encode, true)->Arg(32)->Arg(256);
+BENCHMARK_TEMPLATE(base58Decode, false)->Arg(32)->Arg(256);
+BENCHMARK_TEMPLATE(base58Decode, true)->Arg(32)->Arg(256);
+
+BENCHMARK_TEMPLATE(base85Encode, Ascii85)->Apply(sizes);
+BENCHMARK_TEMPLATE(base85Encode, Z85)->Apply(sizes);
+BENCHMARK_TEMPLATE(base85Decode, Ascii85)->Apply(levels);
+BENCHMARK_TEMPLATE(base85Decode, Z85)->Apply(levels);
+
+BENCHMARK_TEMPLATE(hashEncoded, true)->Apply(sizes);
+BENCHMARK_TEMPLATE(hashEncoded, false)->Apply(sizes);
+
+BENCHMARK_MAIN();
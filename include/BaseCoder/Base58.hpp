@@ -0,0 +1,817 @@
+#ifndef BASECODER_BASE58_HPP
+#define BASECODER_BASE58_HPP
+
+#include <BaseCoder/BaseCoder.hpp>
+#include <BaseCoder/Swar.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace base_coder
+{
+
+///
+/// \brief The Base58Traits struct: alphabet of Bitcoin and IPFS
+///
+struct Base58Traits
+{
+	using AlphabetType = char;
+	static constexpr AlphabetType alphabet[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZ"
+			"abcdefghijkmnopqrstuvwxyz";
+	static constexpr auto alphabetSize = (sizeof(alphabet) / sizeof(AlphabetType)) - 1;
+};
+
+///
+/// \brief The Base58FlickrTraits struct: alphabet of Flickr short URLs
+///
+struct Base58FlickrTraits
+{
+	using AlphabetType = char;
+	static constexpr AlphabetType alphabet[] = "123456789abcdefghijkmnopqrstuvwxyz"
+			"ABCDEFGHJKLMNPQRSTUVWXYZ";
+	static constexpr auto alphabetSize = (sizeof(alphabet) / sizeof(AlphabetType)) - 1;
+};
+
+namespace detail
+{
+
+///
+/// \brief multiplyWide
+/// \param first
+/// \param second
+/// \param high high word of product
+/// \return low word of product
+///
+inline std::uint64_t multiplyWide(std::uint64_t first, std::uint64_t second
+		, std::uint64_t &high)
+{
+#if defined(__SIZEOF_INT128__)
+	__extension__ typedef unsigned __int128 Wide;
+	const Wide product = static_cast<Wide>(first) * second;
+	high = static_cast<std::uint64_t>(product >> 64);
+	return static_cast<std::uint64_t>(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	return _umul128(first, second, &high);
+#else
+	const std::uint64_t low = (first & 0xFFFFFFFF) * (second & 0xFFFFFFFF);
+	const std::uint64_t middle1 = (first >> 32) * (second & 0xFFFFFFFF);
+	const std::uint64_t middle2 = (first & 0xFFFFFFFF) * (second >> 32);
+	const std::uint64_t middle = (low >> 32) + (middle1 & 0xFFFFFFFF) + (middle2 & 0xFFFFFFFF);
+	high = (first >> 32) * (second >> 32) + (middle1 >> 32) + (middle2 >> 32) + (middle >> 32);
+	return (middle << 32) | (low & 0xFFFFFFFF);
+#endif
+}
+
+///
+/// \brief The InvariantDivider class: division of 128-bit number by constant
+/// with precomputed reciprocal (Moller and Granlund, "Improved division by
+/// invariant integers"), two multiplications instead of hardware division
+///
+class InvariantDivider
+{
+public:
+	///
+	/// \brief InvariantDivider
+	/// \param divisor non-zero
+	///
+	constexpr explicit InvariantDivider(std::uint64_t divisor)
+		: shift{ leadingZeros(divisor) }
+		, normalized{ divisor << shift }
+		, reciprocal{ makeReciprocal(divisor << shift) }
+	{}
+
+	///
+	/// \brief divide
+	/// \param high high word of dividend, less than divisor
+	/// \param low low word of dividend
+	/// \param remainder
+	/// \return quotient
+	///
+	std::uint64_t divide(std::uint64_t high, std::uint64_t low
+			, std::uint64_t &remainder) const
+	{
+		// dividend is shifted with divisor, the quotient doesn't change
+		const std::uint64_t top = (high << shift) | ((low >> 1) >> (63 - shift));
+		const std::uint64_t bottom = low << shift;
+
+		std::uint64_t quotient;
+		std::uint64_t fraction = multiplyWide(reciprocal, top, quotient);
+		fraction += bottom;
+		quotient += top + 1 + (fraction < bottom);
+
+		std::uint64_t rest = bottom - quotient * normalized;
+		if (rest > fraction)
+		{
+			--quotient;
+			rest += normalized;
+		}
+		if (rest >= normalized)
+		{
+			++quotient;
+			rest -= normalized;
+		}
+		remainder = rest >> shift;
+		return quotient;
+	}
+
+private:
+	static constexpr unsigned leadingZeros(std::uint64_t value)
+	{
+		unsigned count = 0;
+		while (!(value & (std::uint64_t{ 1 } << 63)))
+		{
+			value <<= 1;
+			++count;
+		}
+		return count;
+	}
+
+	///
+	/// \brief makeReciprocal
+	/// \param divisor with the highest bit set
+	/// \return (2^128 - 1) / divisor - 2^64
+	///
+	static constexpr std::uint64_t makeReciprocal(std::uint64_t divisor)
+	{
+		// the same as (2^128 - 1 - divisor * 2^64) / divisor, bit by bit
+		std::uint64_t rest = ~divisor;
+		std::uint64_t low = ~std::uint64_t{};
+		std::uint64_t quotient = 0;
+		for (int i = 0; i != 64; ++i)
+		{
+			const bool carry = rest >> 63;
+			rest = (rest << 1) | (low >> 63);
+			low <<= 1;
+			quotient <<= 1;
+			if (carry || rest >= divisor)
+			{
+				rest -= divisor;
+				quotient |= 1;
+			}
+		}
+		return quotient;
+	}
+
+private:
+	unsigned shift; ///<
+	std::uint64_t normalized; ///< divisor << shift
+	std::uint64_t reciprocal; ///<
+};
+
+///
+/// \brief The SmallBuffer class: storage on stack for small sizes, on heap
+/// for large ones
+/// \tparam T
+/// \tparam CAPACITY count of elements on stack
+///
+template<typename T, std::size_t CAPACITY>
+class SmallBuffer
+{
+public:
+	explicit SmallBuffer(std::size_t size)
+	{
+		if (size > CAPACITY)
+		{
+			heap.resize(size);
+			pointer = heap.data();
+		}
+	}
+
+	SmallBuffer(const SmallBuffer &) = delete;
+	SmallBuffer &operator=(const SmallBuffer &) = delete;
+
+	T *data()
+	{
+		return pointer;
+	}
+
+private:
+	std::array<T, CAPACITY> local; ///<
+	std::vector<T> heap; ///<
+	T *pointer = local.data(); ///<
+};
+
+///
+/// \brief Count of Base58 digits in one limb
+///
+constexpr std::size_t base58LimbDigits = 10;
+
+///
+/// \brief 58^10, the largest power of 58 in 64 bits
+///
+constexpr std::uint64_t base58LimbBase = 430804206899405824ull;
+
+///
+/// \brief 58^5, half of limb in 32 bits
+///
+constexpr std::uint32_t base58HalfLimbBase = 656356768u;
+
+constexpr InvariantDivider base58LimbDivider{ base58LimbBase };
+
+///
+/// \brief base58Powers: 58^i for i in 0..10
+///
+constexpr std::array<std::uint64_t, base58LimbDigits + 1> base58Powers = []()
+{
+	std::array<std::uint64_t, base58LimbDigits + 1> powers{};
+	powers[0] = 1;
+	for (std::size_t i = 1; i != powers.size(); ++i)
+	{
+		powers[i] = powers[i - 1] * 58;
+	}
+	return powers;
+}();
+
+static_assert(base58Powers[base58LimbDigits] == base58LimbBase, "");
+static_assert(base58Powers[5] == base58HalfLimbBase, "");
+
+} // namespace detail
+
+///
+/// \brief The Base58Coder class: big-number conversion of bytes to radix 58,
+/// every leading zero byte is coded by the first character of alphabet.
+/// The number is kept in 64-bit limbs of base 58^10, so one step of
+/// conversion processes 8 bytes or 10 characters
+/// \tparam Trait
+///
+template<typename Trait>
+class Base58Coder
+{
+public:
+	using AlphabetType = typename Trait::AlphabetType;
+
+	static constexpr auto alphabet = Trait::alphabet;
+	static constexpr auto alphabetSize = Trait::alphabetSize;
+	static constexpr auto reverseAlphabet = detail::makeRadixReverseAlphabet<Trait>();
+
+	static_assert(alphabetSize == 58, "Base58 alphabet needs 58 characters");
+
+	///
+	/// \brief encodeSize: exact size, costs as much as encoding
+	/// \tparam InputIterator
+	/// \param inputView
+	/// \return count of encoded characters
+	///
+	template<typename InputIterator>
+	std::size_t encodeSize(View<InputIterator> inputView) const;
+
+	///
+	/// \brief encodeSize: exact size, costs as much as encoding
+	/// \tparam Container
+	/// \param container
+	/// \return count of encoded characters
+	///
+	template<typename Container>
+	std::size_t encodeSize(const Container &container) const;
+
+	///
+	/// \brief decodeSize: exact size, costs as much as decoding
+	/// \tparam InputIterator
+	/// \param inputView
+	/// \return count of decoded bytes
+	///
+	template<typename InputIterator>
+	std::size_t decodeSize(View<InputIterator> inputView) const;
+
+	///
+	/// \brief decodeSize: exact size, costs as much as decoding
+	/// \tparam Container
+	/// \param container
+	/// \return count of decoded bytes
+	///
+	template<typename Container>
+	std::size_t decodeSize(const Container &container) const;
+
+	///
+	/// \brief upperBoundEncodeSize
+	/// \param size count of input bytes
+	/// \return maximal count of encoded characters, without looking at data
+	///
+	static constexpr std::size_t upperBoundEncodeSize(std::size_t size);
+
+	///
+	/// \brief upperBoundDecodeSize
+	/// \param encodedSize count of encoded characters
+	/// \return maximal count of decoded bytes, without looking at data
+	///
+	static constexpr std::size_t upperBoundDecodeSize(std::size_t encodedSize);
+
+	///
+	/// \brief encode
+	/// \tparam InputIterator
+	/// \tparam OutputIterator
+	/// \param inputView
+	/// \param outputIterator
+	///
+	template<typename InputIterator, typename OutputIterator>
+	void encode(View<InputIterator> inputView, OutputIterator outputIterator) const;
+
+	///
+	/// \brief encode
+	/// \tparam Container
+	/// \tparam OutputIterator
+	/// \param container
+	/// \param outputIterator
+	///
+	template<typename Container, typename OutputIterator>
+	void encode(const Container &container, OutputIterator outputIterator) const;
+
+	///
+	/// \brief decode: characters outside of alphabet are decoded as zero digits
+	/// \tparam InputIterator
+	/// \tparam OutputIterator
+	/// \param inputView
+	/// \param outputIterator
+	///
+	template<typename InputIterator, typename OutputIterator>
+	void decode(View<InputIterator> inputView, OutputIterator outputIterator) const;
+
+	///
+	/// \brief decode: characters outside of alphabet are decoded as zero digits
+	/// \tparam Container
+	/// \tparam OutputIterator
+	/// \param container
+	/// \param outputIterator
+	///
+	template<typename Container, typename OutputIterator>
+	void decode(const Container &container, OutputIterator outputIterator) const;
+
+	///
+	/// \brief encode contiguous data
+	/// \param input
+	/// \param size count of input bytes
+	/// \param output buffer for upperBoundEncodeSize characters
+	/// \return count of written characters
+	///
+	std::size_t encode(const std::uint8_t *input, std::size_t size
+			, AlphabetType *output) const;
+
+	///
+	/// \brief decode contiguous data, characters outside of alphabet are decoded
+	/// as zero digits
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for upperBoundDecodeSize bytes
+	/// \return count of written bytes
+	///
+	std::size_t decode(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+
+#if defined(__cpp_lib_span)
+	///
+	/// \brief encode contiguous data
+	/// \param input
+	/// \param output buffer for upperBoundEncodeSize characters
+	/// \return count of written characters
+	///
+	std::size_t encode(std::span<const std::byte> input
+			, std::span<AlphabetType> output) const;
+
+	///
+	/// \brief decode contiguous data
+	/// \param input
+	/// \param output buffer for upperBoundDecodeSize bytes
+	/// \return count of written bytes
+	///
+	std::size_t decode(std::span<const AlphabetType> input
+			, std::span<std::byte> output) const;
+#endif
+
+	///
+	/// \brief decodeChecked
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for upperBoundDecodeSize bytes
+	/// \return status, offset of the first bad character and count of written
+	/// bytes, nothing is written on error
+	///
+	DecodeResult decodeChecked(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+
+	///
+	/// \brief validate
+	/// \param input
+	/// \param size count of input characters
+	/// \return status, offset of the first bad character and count of bytes
+	/// which decodeChecked would write
+	///
+	DecodeResult validate(const AlphabetType *input, std::size_t size) const;
+
+#if defined(__cpp_lib_span)
+	///
+	/// \brief decodeChecked
+	/// \param input
+	/// \param output buffer for upperBoundDecodeSize bytes
+	/// \return status, offset of the first bad character and count of written bytes
+	///
+	DecodeResult decodeChecked(std::span<const AlphabetType> input
+			, std::span<std::byte> output) const;
+
+	///
+	/// \brief validate
+	/// \param input
+	/// \return status, offset of the first bad character and count of bytes
+	/// which decodeChecked would write
+	///
+	DecodeResult validate(std::span<const AlphabetType> input) const;
+#endif
+
+private:
+	///
+	/// \brief Count of limbs kept on stack, enough for 256-byte input
+	///
+	static constexpr std::size_t stackLimbs = 48;
+
+	///
+	/// \brief toLimbs: conversion of bytes without leading zeros to limbs
+	/// \param input
+	/// \param size count of input bytes
+	/// \param limbs buffer for size / 7 + 2 limbs
+	/// \return count of limbs, the least significant first
+	///
+	static std::size_t toLimbs(const std::uint8_t *input, std::size_t size
+			, std::uint64_t *limbs);
+
+	///
+	/// \brief writeLimb: exactly 10 characters of limb
+	/// \param limb
+	/// \param output
+	///
+	static void writeLimb(std::uint64_t limb, AlphabetType *output);
+
+	///
+	/// \brief checkedDecode
+	/// \tparam CHECKED stop at the first character outside of alphabet
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for decoded bytes, nullptr to count them only
+	/// \return status, offset of the first bad character and count of bytes
+	///
+	template<bool CHECKED>
+	DecodeResult checkedDecode(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+};
+
+using Base58 = Base58Coder<Base58Traits>;
+using Base58Flickr = Base58Coder<Base58FlickrTraits>;
+
+template<typename Trait>
+template<typename InputIterator>
+std::size_t Base58Coder<Trait>::encodeSize(View<InputIterator> inputView) const
+{
+	detail::checkIteratorType<AlphabetType, InputIterator>();
+
+	if constexpr (View<InputIterator>::isContiguous)
+	{
+		const std::size_t size = inputView.size();
+		detail::SmallBuffer<AlphabetType, 512> output(upperBoundEncodeSize(size));
+		return encode(reinterpret_cast<const std::uint8_t *>(inputView.data()), size
+				, output.data());
+	}
+	else
+	{
+		const std::vector<std::uint8_t> input(inputView.begin(), inputView.end());
+		return encodeSize(makeConstView(input));
+	}
+}
+
+template<typename Trait>
+template<typename Container>
+std::size_t Base58Coder<Trait>::encodeSize(const Container &container) const
+{
+	return encodeSize(makeConstView(container));
+}
+
+template<typename Trait>
+template<typename InputIterator>
+std::size_t Base58Coder<Trait>::decodeSize(View<InputIterator> inputView) const
+{
+	detail::checkIteratorType<AlphabetType, InputIterator>();
+
+	if constexpr (View<InputIterator>::isContiguous)
+	{
+		return checkedDecode<false>(reinterpret_cast<const AlphabetType *>(inputView.data())
+				, inputView.size(), nullptr).written;
+	}
+	else
+	{
+		const std::vector<AlphabetType> input(inputView.begin(), inputView.end());
+		return checkedDecode<false>(input.data(), input.size(), nullptr).written;
+	}
+}
+
+template<typename Trait>
+template<typename Container>
+std::size_t Base58Coder<Trait>::decodeSize(const Container &container) const
+{
+	return decodeSize(makeConstView(container));
+}
+
+template<typename Trait>
+constexpr std::size_t Base58Coder<Trait>::upperBoundEncodeSize(std::size_t size)
+{
+	// log(256) / log(58) < 1.37
+	return size * 137 / 100 + 1;
+}
+
+template<typename Trait>
+constexpr std::size_t Base58Coder<Trait>::upperBoundDecodeSize(std::size_t encodedSize)
+{
+	// every leading zero digit is a byte
+	return encodedSize;
+}
+
+template<typename Trait>
+template<typename InputIterator, typename OutputIterator>
+void Base58Coder<Trait>::encode(View<InputIterator> inputView
+		, OutputIterator outputIterator) const
+{
+	detail::checkIteratorType<AlphabetType, InputIterator>();
+
+	if constexpr (View<InputIterator>::isContiguous)
+	{
+		const std::size_t size = inputView.size();
+		detail::SmallBuffer<AlphabetType, 512> output(upperBoundEncodeSize(size));
+		const std::size_t written = encode(
+				reinterpret_cast<const std::uint8_t *>(inputView.data()), size, output.data());
+		std::copy(output.data(), output.data() + written, outputIterator);
+	}
+	else
+	{
+		const std::vector<std::uint8_t> input(inputView.begin(), inputView.end());
+		encode(makeConstView(input), outputIterator);
+	}
+}
+
+template<typename Trait>
+template<typename Container, typename OutputIterator>
+void Base58Coder<Trait>::encode(const Container &container
+		, OutputIterator outputIterator) const
+{
+	encode(makeView(std::cref(container)), outputIterator);
+}
+
+template<typename Trait>
+template<typename InputIterator, typename OutputIterator>
+void Base58Coder<Trait>::decode(View<InputIterator> inputView
+		, OutputIterator outputIterator) const
+{
+	detail::checkIteratorType<AlphabetType, InputIterator>();
+
+	if constexpr (View<InputIterator>::isContiguous)
+	{
+		const std::size_t size = inputView.size();
+		detail::SmallBuffer<std::uint8_t, 512> output(upperBoundDecodeSize(size));
+		const std::size_t written = decode(
+				reinterpret_cast<const AlphabetType *>(inputView.data()), size, output.data());
+		std::copy(output.data(), output.data() + written, outputIterator);
+	}
+	else
+	{
+		const std::vector<AlphabetType> input(inputView.begin(), inputView.end());
+		decode(makeConstView(input), outputIterator);
+	}
+}
+
+template<typename Trait>
+template<typename Container, typename OutputIterator>
+void Base58Coder<Trait>::decode(const Container &container
+		, OutputIterator outputIterator) const
+{
+	decode(makeView(std::cref(container)), outputIterator);
+}
+
+template<typename Trait>
+std::size_t Base58Coder<Trait>::encode(const std::uint8_t *input, std::size_t size
+		, AlphabetType *output) const
+{
+	std::size_t zeros = 0;
+	while (zeros != size && input[zeros] == 0)
+	{
+		output[zeros++] = alphabet[0];
+	}
+
+	detail::SmallBuffer<std::uint64_t, stackLimbs> limbs((size - zeros) / 7 + 2);
+	const std::size_t count = toLimbs(input + zeros, size - zeros, limbs.data());
+	if (count == 0)
+	{
+		return zeros;
+	}
+
+	// leading zero digits of the most significant limb aren't written
+	AlphabetType top[detail::base58LimbDigits];
+	writeLimb(limbs.data()[count - 1], top);
+	std::size_t skipped = 0;
+	while (top[skipped] == alphabet[0])
+	{
+		++skipped;
+	}
+	std::size_t written = zeros + detail::base58LimbDigits - skipped;
+	std::copy(top + skipped, top + detail::base58LimbDigits, output + zeros);
+	for (std::size_t i = count - 1; i-- != 0; written += detail::base58LimbDigits)
+	{
+		writeLimb(limbs.data()[i], output + written);
+	}
+	return written;
+}
+
+template<typename Trait>
+std::size_t Base58Coder<Trait>::decode(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
+{
+	return checkedDecode<false>(input, size, output).written;
+}
+
+#if defined(__cpp_lib_span)
+template<typename Trait>
+std::size_t Base58Coder<Trait>::encode(std::span<const std::byte> input
+		, std::span<AlphabetType> output) const
+{
+	return encode(reinterpret_cast<const std::uint8_t *>(input.data()), input.size()
+			, output.data());
+}
+
+template<typename Trait>
+std::size_t Base58Coder<Trait>::decode(std::span<const AlphabetType> input
+		, std::span<std::byte> output) const
+{
+	return decode(input.data(), input.size()
+			, reinterpret_cast<std::uint8_t *>(output.data()));
+}
+#endif
+
+template<typename Trait>
+DecodeResult Base58Coder<Trait>::decodeChecked(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
+{
+	return checkedDecode<true>(input, size, output);
+}
+
+template<typename Trait>
+DecodeResult Base58Coder<Trait>::validate(const AlphabetType *input, std::size_t size) const
+{
+	return checkedDecode<true>(input, size, nullptr);
+}
+
+#if defined(__cpp_lib_span)
+template<typename Trait>
+DecodeResult Base58Coder<Trait>::decodeChecked(std::span<const AlphabetType> input
+		, std::span<std::byte> output) const
+{
+	return decodeChecked(input.data(), input.size()
+			, reinterpret_cast<std::uint8_t *>(output.data()));
+}
+
+template<typename Trait>
+DecodeResult Base58Coder<Trait>::validate(std::span<const AlphabetType> input) const
+{
+	return validate(input.data(), input.size());
+}
+#endif
+
+// private
+
+template<typename Trait>
+std::size_t Base58Coder<Trait>::toLimbs(const std::uint8_t *input, std::size_t size
+		, std::uint64_t *limbs)
+{
+	std::size_t count = 0;
+	auto append = [limbs, &count](std::uint64_t carry)
+	{
+		for (; carry; carry /= detail::base58LimbBase)
+		{
+			limbs[count++] = carry % detail::base58LimbBase;
+		}
+	};
+
+	// the first word takes the incomplete group of bytes, the number is empty yet
+	const std::size_t head = size % sizeof(std::uint64_t);
+	std::uint64_t word = 0;
+	for (std::size_t i = 0; i != head; ++i)
+	{
+		word = (word << CHAR_BIT) | input[i];
+	}
+	append(word);
+
+	// number = number * 2^64 + word, from the least significant limb
+	for (std::size_t position = head; position != size; position += sizeof(word))
+	{
+		std::memcpy(&word, input + position, sizeof(word));
+		std::uint64_t carry = swar::detail::toBigEndian(word);
+		for (std::size_t i = 0; i != count; ++i)
+		{
+			carry = detail::base58LimbDivider.divide(limbs[i], carry, limbs[i]);
+		}
+		append(carry);
+	}
+	return count;
+}
+
+template<typename Trait>
+void Base58Coder<Trait>::writeLimb(std::uint64_t limb, AlphabetType *output)
+{
+	// halves are split by 32-bit arithmetic
+	std::uint32_t high = static_cast<std::uint32_t>(limb / detail::base58HalfLimbBase);
+	std::uint32_t low = static_cast<std::uint32_t>(limb % detail::base58HalfLimbBase);
+	for (std::size_t i = 5; i-- != 0; high /= 58, low /= 58)
+	{
+		output[i] = alphabet[high % 58];
+		output[i + 5] = alphabet[low % 58];
+	}
+}
+
+template<typename Trait>
+template<bool CHECKED>
+DecodeResult Base58Coder<Trait>::checkedDecode(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
+{
+	DecodeResult result;
+	std::size_t zeros = 0;
+	while (zeros != size && input[zeros] == alphabet[0])
+	{
+		++zeros;
+	}
+
+	// number = number * 58^digits + group, groups of 10 digits after the first one
+	detail::SmallBuffer<std::uint64_t, stackLimbs> limbs((size - zeros) / 10 + 2);
+	std::size_t count = 0;
+	std::size_t position = zeros;
+	std::size_t groupSize = (size - zeros) % detail::base58LimbDigits;
+	if (groupSize == 0)
+	{
+		groupSize = detail::base58LimbDigits;
+	}
+	for (; position != size; position += groupSize, groupSize = detail::base58LimbDigits)
+	{
+		std::uint64_t carry = 0;
+		for (std::size_t i = position; i != position + groupSize; ++i)
+		{
+			std::uint8_t index = reverseAlphabet[static_cast<std::uint8_t>(input[i])];
+			if (index >= alphabetSize)
+			{
+				if constexpr (CHECKED)
+				{
+					result.status = DecodeStatus::InvalidCharacter;
+					result.errorOffset = i;
+					return result;
+				}
+				index = 0;
+			}
+			carry = carry * 58 + index;
+		}
+
+		const std::uint64_t multiplier = detail::base58Powers[groupSize];
+		for (std::size_t i = 0; i != count; ++i)
+		{
+			std::uint64_t high;
+			const std::uint64_t low = detail::multiplyWide(limbs.data()[i], multiplier, high)
+					+ carry;
+			limbs.data()[i] = low;
+			carry = high + (low < carry);
+		}
+		if (carry)
+		{
+			limbs.data()[count++] = carry;
+		}
+	}
+
+	std::size_t topBytes = 0;
+	if (count)
+	{
+		for (std::uint64_t top = limbs.data()[count - 1]; top; top >>= CHAR_BIT)
+		{
+			++topBytes;
+		}
+	}
+	result.errorOffset = size;
+	result.written = zeros + (count ? (count - 1) * sizeof(std::uint64_t) + topBytes : 0);
+	if (output == nullptr)
+	{
+		return result;
+	}
+
+	std::fill(output, output + zeros, std::uint8_t{ 0 });
+	output += zeros;
+	for (std::size_t i = topBytes; i-- != 0; )
+	{
+		*output++ = static_cast<std::uint8_t>(limbs.data()[count - 1] >> (i * CHAR_BIT));
+	}
+	for (std::size_t i = count; i-- > 1; output += sizeof(std::uint64_t))
+	{
+		const std::uint64_t word = swar::detail::toBigEndian(limbs.data()[i - 1]);
+		std::memcpy(output, &word, sizeof(word));
+	}
+	return result;
+}
+
+} // namespace base_coder
+
+#endif // BASECODER_BASE58_HPP
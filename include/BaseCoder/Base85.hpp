@@ -0,0 +1,732 @@
+#ifndef BASECODER_BASE85_HPP
+#define BASECODER_BASE85_HPP
+
+#include <BaseCoder/BaseCoder.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace base_coder
+{
+
+///
+/// \brief The Ascii85Traits struct: alphabet of btoa, PostScript and PDF, without
+/// "<~" and "~>" delimiters
+///
+struct Ascii85Traits
+{
+	using AlphabetType = char;
+	static constexpr AlphabetType alphabet[] = "!\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHI"
+			"JKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstu";
+	static constexpr auto alphabetSize = (sizeof(alphabet) / sizeof(AlphabetType)) - 1;
+	static constexpr AlphabetType zeroGroup = 'z'; ///< shortcut for 4 zero bytes
+};
+
+///
+/// \brief The Z85Traits struct: alphabet of ZeroMQ (RFC 32), safe in source code
+/// and XML
+///
+struct Z85Traits
+{
+	using AlphabetType = char;
+	static constexpr AlphabetType alphabet[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDE"
+			"FGHIJKLMNOPQRSTUVWXYZ.-:+=^!/*?&<>()[]{}@%$#";
+	static constexpr auto alphabetSize = (sizeof(alphabet) / sizeof(AlphabetType)) - 1;
+	static constexpr AlphabetType zeroGroup = '\0'; ///< no shortcut
+};
+
+///
+/// \brief The Base85Coder class: every 4 bytes are coded by 5 characters of
+/// big-endian 32-bit value in radix 85. The last incomplete group of N bytes is
+/// padded by zero bytes and coded by N + 1 characters, as Ascii85 does; Z85 of
+/// RFC 32 is the case of input size multiple of 4
+/// \tparam Trait
+///
+template<typename Trait>
+class Base85Coder
+{
+public:
+	using AlphabetType = typename Trait::AlphabetType;
+
+	static constexpr auto alphabet = Trait::alphabet;
+	static constexpr auto alphabetSize = Trait::alphabetSize;
+	static constexpr auto zeroGroup = Trait::zeroGroup;
+	static constexpr auto reverseAlphabet = detail::makeRadixReverseAlphabet<Trait>();
+	static constexpr std::size_t inputBufferSize = 4;
+	static constexpr std::size_t indexBufferSize = 5;
+
+	static_assert(alphabetSize == 85, "Base85 alphabet needs 85 characters");
+
+	///
+	/// \brief encodeSize: exact size, input is read for zero groups if Trait has
+	/// zeroGroup
+	/// \tparam InputIterator
+	/// \param inputView
+	/// \return count of encoded characters
+	///
+	template<typename InputIterator>
+	std::size_t encodeSize(View<InputIterator> inputView) const;
+
+	///
+	/// \brief encodeSize
+	/// \tparam Container
+	/// \param container
+	/// \return count of encoded characters
+	///
+	template<typename Container>
+	std::size_t encodeSize(const Container &container) const;
+
+	///
+	/// \brief decodeSize: exact size of valid input
+	/// \tparam InputIterator
+	/// \param inputView
+	/// \return count of decoded bytes
+	///
+	template<typename InputIterator>
+	std::size_t decodeSize(View<InputIterator> inputView) const;
+
+	///
+	/// \brief decodeSize: exact size of valid input
+	/// \tparam Container
+	/// \param container
+	/// \return count of decoded bytes
+	///
+	template<typename Container>
+	std::size_t decodeSize(const Container &container) const;
+
+	///
+	/// \brief upperBoundEncodeSize
+	/// \param size count of input bytes
+	/// \return maximal count of encoded characters, without looking at data
+	///
+	static constexpr std::size_t upperBoundEncodeSize(std::size_t size);
+
+	///
+	/// \brief upperBoundDecodeSize
+	/// \param encodedSize count of encoded characters
+	/// \return maximal count of decoded bytes, without looking at data
+	///
+	static constexpr std::size_t upperBoundDecodeSize(std::size_t encodedSize);
+
+	///
+	/// \brief encode
+	/// \tparam InputIterator
+	/// \tparam OutputIterator
+	/// \param inputView
+	/// \param outputIterator
+	///
+	template<typename InputIterator, typename OutputIterator>
+	void encode(View<InputIterator> inputView, OutputIterator outputIterator) const;
+
+	///
+	/// \brief encode
+	/// \tparam Container
+	/// \tparam OutputIterator
+	/// \param container
+	/// \param outputIterator
+	///
+	template<typename Container, typename OutputIterator>
+	void encode(const Container &container, OutputIterator outputIterator) const;
+
+	///
+	/// \brief decode: characters outside of alphabet are decoded as zero digits
+	/// \tparam InputIterator
+	/// \tparam OutputIterator
+	/// \param inputView
+	/// \param outputIterator
+	///
+	template<typename InputIterator, typename OutputIterator>
+	void decode(View<InputIterator> inputView, OutputIterator outputIterator) const;
+
+	///
+	/// \brief decode: characters outside of alphabet are decoded as zero digits
+	/// \tparam Container
+	/// \tparam OutputIterator
+	/// \param container
+	/// \param outputIterator
+	///
+	template<typename Container, typename OutputIterator>
+	void decode(const Container &container, OutputIterator outputIterator) const;
+
+	///
+	/// \brief encode contiguous data
+	/// \param input
+	/// \param size count of input bytes
+	/// \param output buffer for upperBoundEncodeSize characters
+	/// \return count of written characters
+	///
+	std::size_t encode(const std::uint8_t *input, std::size_t size
+			, AlphabetType *output) const;
+
+	///
+	/// \brief decode contiguous data, characters outside of alphabet are decoded
+	/// as zero digits
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for upperBoundDecodeSize bytes
+	/// \return count of written bytes
+	///
+	std::size_t decode(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+
+#if defined(__cpp_lib_span)
+	///
+	/// \brief encode contiguous data
+	/// \param input
+	/// \param output buffer for upperBoundEncodeSize characters
+	/// \return count of written characters
+	///
+	std::size_t encode(std::span<const std::byte> input
+			, std::span<AlphabetType> output) const;
+
+	///
+	/// \brief decode contiguous data
+	/// \param input
+	/// \param output buffer for upperBoundDecodeSize bytes
+	/// \return count of written bytes
+	///
+	std::size_t decode(std::span<const AlphabetType> input
+			, std::span<std::byte> output) const;
+#endif
+
+	///
+	/// \brief decodeChecked: groups above 2^32 - 1 are invalid at their first
+	/// character, so is the last group of single character
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for upperBoundDecodeSize bytes
+	/// \return status, offset of the first bad character and count of written
+	/// bytes, only whole valid groups on error
+	///
+	DecodeResult decodeChecked(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+
+	///
+	/// \brief validate
+	/// \param input
+	/// \param size count of input characters
+	/// \return status, offset of the first bad character and count of bytes
+	/// which decodeChecked would write
+	///
+	DecodeResult validate(const AlphabetType *input, std::size_t size) const;
+
+#if defined(__cpp_lib_span)
+	///
+	/// \brief decodeChecked
+	/// \param input
+	/// \param output buffer for upperBoundDecodeSize bytes
+	/// \return status, offset of the first bad character and count of written bytes
+	///
+	DecodeResult decodeChecked(std::span<const AlphabetType> input
+			, std::span<std::byte> output) const;
+
+	///
+	/// \brief validate
+	/// \param input
+	/// \return status, offset of the first bad character and count of bytes
+	/// which decodeChecked would write
+	///
+	DecodeResult validate(std::span<const AlphabetType> input) const;
+#endif
+
+private:
+	///
+	/// \brief Count of groups of staging buffers of iterator interface
+	///
+	static constexpr std::size_t stagingGroups = 256;
+
+	///
+	/// \brief writeGroup: exactly 5 characters of value
+	/// \param value
+	/// \param output
+	///
+	static void writeGroup(std::uint32_t value, AlphabetType *output);
+
+	///
+	/// \brief decodeGroups: whole groups and zero groups, by vector kernels
+	/// where possible
+	/// \tparam CHECKED stop at the first character outside of alphabet
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for decoded bytes, nullptr to count them only
+	/// \return status, offset of the first bad character or count of consumed
+	/// characters, the rest is shorter than group, and count of bytes
+	///
+	template<bool CHECKED>
+	DecodeResult decodeGroups(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+
+	///
+	/// \brief decodeGroup
+	/// \tparam CHECKED
+	/// \param input
+	/// \param size count of characters, 2..5, the rest is padded by the last digit
+	/// \param value
+	/// \return offset of the first bad character, size if group is valid
+	///
+	template<bool CHECKED>
+	static std::size_t decodeGroup(const AlphabetType *input, std::size_t size
+			, std::uint32_t &value);
+
+	///
+	/// \brief checkedDecode
+	/// \tparam CHECKED
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for decoded bytes, nullptr to count them only
+	/// \return status, offset of the first bad character and count of bytes
+	///
+	template<bool CHECKED>
+	DecodeResult checkedDecode(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+};
+
+using Ascii85 = Base85Coder<Ascii85Traits>;
+using Z85 = Base85Coder<Z85Traits>;
+
+template<typename Trait>
+template<typename InputIterator>
+std::size_t Base85Coder<Trait>::encodeSize(View<InputIterator> inputView) const
+{
+	detail::checkIteratorType<AlphabetType, InputIterator>();
+
+	if constexpr (zeroGroup == 0)
+	{
+		const std::size_t size = inputView.size();
+		const std::size_t tailSize = size % inputBufferSize;
+		return size / inputBufferSize * indexBufferSize + (tailSize ? tailSize + 1 : 0);
+	}
+	else
+	{
+		std::size_t result = 0;
+		std::size_t count = 0;
+		bool zero = true;
+		for (auto i : inputView)
+		{
+			zero &= (static_cast<std::uint8_t>(i) == 0);
+			if (++count == inputBufferSize)
+			{
+				result += zero ? 1 : indexBufferSize;
+				count = 0;
+				zero = true;
+			}
+		}
+		return result + (count ? count + 1 : 0);
+	}
+}
+
+template<typename Trait>
+template<typename Container>
+std::size_t Base85Coder<Trait>::encodeSize(const Container &container) const
+{
+	return encodeSize(makeConstView(container));
+}
+
+template<typename Trait>
+template<typename InputIterator>
+std::size_t Base85Coder<Trait>::decodeSize(View<InputIterator> inputView) const
+{
+	detail::checkIteratorType<AlphabetType, InputIterator>();
+
+	if constexpr (zeroGroup == 0)
+	{
+		const std::size_t size = inputView.size();
+		const std::size_t tailSize = size % indexBufferSize;
+		return size / indexBufferSize * inputBufferSize + (tailSize ? tailSize - 1 : 0);
+	}
+	else
+	{
+		std::size_t result = 0;
+		std::size_t count = 0;
+		for (auto i : inputView)
+		{
+			if (count == 0 && i == zeroGroup)
+			{
+				result += inputBufferSize;
+			}
+			else if (++count == indexBufferSize)
+			{
+				result += inputBufferSize;
+				count = 0;
+			}
+		}
+		return result + (count ? count - 1 : 0);
+	}
+}
+
+template<typename Trait>
+template<typename Container>
+std::size_t Base85Coder<Trait>::decodeSize(const Container &container) const
+{
+	return decodeSize(makeConstView(container));
+}
+
+template<typename Trait>
+constexpr std::size_t Base85Coder<Trait>::upperBoundEncodeSize(std::size_t size)
+{
+	return (size + inputBufferSize - 1) / inputBufferSize * indexBufferSize;
+}
+
+template<typename Trait>
+constexpr std::size_t Base85Coder<Trait>::upperBoundDecodeSize(std::size_t encodedSize)
+{
+	if constexpr (zeroGroup == 0)
+	{
+		return (encodedSize + indexBufferSize - 1) / indexBufferSize * inputBufferSize;
+	}
+	else
+	{
+		// every character may be zero group
+		return encodedSize * inputBufferSize;
+	}
+}
+
+template<typename Trait>
+template<typename InputIterator, typename OutputIterator>
+void Base85Coder<Trait>::encode(View<InputIterator> inputView
+		, OutputIterator outputIterator) const
+{
+	detail::checkIteratorType<AlphabetType, InputIterator>();
+
+	std::array<AlphabetType, indexBufferSize * stagingGroups> output;
+	if constexpr (View<InputIterator>::isContiguous)
+	{
+		const auto *input = reinterpret_cast<const std::uint8_t *>(inputView.data());
+		const std::size_t size = inputView.size();
+		for (std::size_t position = 0; position != size; )
+		{
+			const std::size_t count = std::min(inputBufferSize * stagingGroups
+					, size - position);
+			const std::size_t written = encode(input + position, count, output.data());
+			outputIterator = std::copy(output.data(), output.data() + written
+					, outputIterator);
+			position += count;
+		}
+	}
+	else
+	{
+		std::array<std::uint8_t, inputBufferSize * stagingGroups> input;
+		std::size_t inputIndex = 0;
+		for (auto i : inputView)
+		{
+			input[inputIndex++] = static_cast<std::uint8_t>(i);
+			if (inputIndex == input.size())
+			{
+				inputIndex = 0;
+				const std::size_t written = encode(input.data(), input.size(), output.data());
+				outputIterator = std::copy(output.data(), output.data() + written
+						, outputIterator);
+			}
+		}
+		const std::size_t written = encode(input.data(), inputIndex, output.data());
+		std::copy(output.data(), output.data() + written, outputIterator);
+	}
+}
+
+template<typename Trait>
+template<typename Container, typename OutputIterator>
+void Base85Coder<Trait>::encode(const Container &container
+		, OutputIterator outputIterator) const
+{
+	encode(makeView(std::cref(container)), outputIterator);
+}
+
+template<typename Trait>
+template<typename InputIterator, typename OutputIterator>
+void Base85Coder<Trait>::decode(View<InputIterator> inputView
+		, OutputIterator outputIterator) const
+{
+	detail::checkIteratorType<AlphabetType, InputIterator>();
+
+	std::array<AlphabetType, indexBufferSize * stagingGroups> input;
+	std::array<std::uint8_t, upperBoundDecodeSize(indexBufferSize * stagingGroups)> output;
+	std::size_t inputIndex = 0;
+	for (auto i : inputView)
+	{
+		input[inputIndex++] = i;
+		if (inputIndex == input.size())
+		{
+			// the rest shorter than group waits for the next characters
+			const DecodeResult result = decodeGroups<false>(input.data(), input.size()
+					, output.data());
+			outputIterator = std::copy(output.data(), output.data() + result.written
+					, outputIterator);
+			std::copy(input.begin() + result.errorOffset, input.end(), input.begin());
+			inputIndex = input.size() - result.errorOffset;
+		}
+	}
+	const std::size_t written = decode(input.data(), inputIndex, output.data());
+	std::copy(output.data(), output.data() + written, outputIterator);
+}
+
+template<typename Trait>
+template<typename Container, typename OutputIterator>
+void Base85Coder<Trait>::decode(const Container &container
+		, OutputIterator outputIterator) const
+{
+	decode(makeView(std::cref(container)), outputIterator);
+}
+
+template<typename Trait>
+std::size_t Base85Coder<Trait>::encode(const std::uint8_t *input, std::size_t size
+		, AlphabetType *output) const
+{
+	const std::size_t tailSize = size % inputBufferSize;
+	std::size_t written = 0;
+	for (std::size_t position = 0; position != size - tailSize
+			; position += inputBufferSize)
+	{
+		const std::uint32_t value = (std::uint32_t{ input[position] } << 24)
+				| (std::uint32_t{ input[position + 1] } << 16)
+				| (std::uint32_t{ input[position + 2] } << 8)
+				| input[position + 3];
+		if constexpr (zeroGroup != 0)
+		{
+			if (value == 0)
+			{
+				output[written++] = zeroGroup;
+				continue;
+			}
+		}
+		writeGroup(value, output + written);
+		written += indexBufferSize;
+	}
+
+	if (tailSize)
+	{
+		// zero bytes of padding only change the dropped characters
+		std::uint32_t value = 0;
+		for (std::size_t i = 0; i != inputBufferSize; ++i)
+		{
+			value = (value << CHAR_BIT) | ((i < tailSize) ? input[size - tailSize + i] : 0);
+		}
+		AlphabetType group[indexBufferSize];
+		writeGroup(value, group);
+		written = static_cast<std::size_t>(std::copy(group, group + tailSize + 1
+				, output + written) - output);
+	}
+	return written;
+}
+
+template<typename Trait>
+std::size_t Base85Coder<Trait>::decode(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
+{
+	return checkedDecode<false>(input, size, output).written;
+}
+
+#if defined(__cpp_lib_span)
+template<typename Trait>
+std::size_t Base85Coder<Trait>::encode(std::span<const std::byte> input
+		, std::span<AlphabetType> output) const
+{
+	return encode(reinterpret_cast<const std::uint8_t *>(input.data()), input.size()
+			, output.data());
+}
+
+template<typename Trait>
+std::size_t Base85Coder<Trait>::decode(std::span<const AlphabetType> input
+		, std::span<std::byte> output) const
+{
+	return decode(input.data(), input.size()
+			, reinterpret_cast<std::uint8_t *>(output.data()));
+}
+#endif
+
+template<typename Trait>
+DecodeResult Base85Coder<Trait>::decodeChecked(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
+{
+	return checkedDecode<true>(input, size, output);
+}
+
+template<typename Trait>
+DecodeResult Base85Coder<Trait>::validate(const AlphabetType *input, std::size_t size) const
+{
+	return checkedDecode<true>(input, size, nullptr);
+}
+
+#if defined(__cpp_lib_span)
+template<typename Trait>
+DecodeResult Base85Coder<Trait>::decodeChecked(std::span<const AlphabetType> input
+		, std::span<std::byte> output) const
+{
+	return decodeChecked(input.data(), input.size()
+			, reinterpret_cast<std::uint8_t *>(output.data()));
+}
+
+template<typename Trait>
+DecodeResult Base85Coder<Trait>::validate(std::span<const AlphabetType> input) const
+{
+	return validate(input.data(), input.size());
+}
+#endif
+
+// private
+
+template<typename Trait>
+void Base85Coder<Trait>::writeGroup(std::uint32_t value, AlphabetType *output)
+{
+	// divisions by constants are multiplications, split to shorten dependency chain
+	const std::uint32_t high = value / (85 * 85 * 85);
+	const std::uint32_t low = value % (85 * 85 * 85);
+	const std::uint32_t middle = low % (85 * 85);
+	output[0] = alphabet[high / 85];
+	output[1] = alphabet[high % 85];
+	output[2] = alphabet[low / (85 * 85)];
+	output[3] = alphabet[middle / 85];
+	output[4] = alphabet[middle % 85];
+}
+
+template<typename Trait>
+template<bool CHECKED>
+DecodeResult Base85Coder<Trait>::decodeGroups(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
+{
+	constexpr std::size_t scratchGroups = 64;
+	std::array<std::uint8_t, inputBufferSize * scratchGroups> scratch;
+
+	DecodeResult result;
+	std::size_t &position = result.errorOffset;
+	while (position != size)
+	{
+		// vector kernels stop before zero group, invalid character or overflow
+		std::size_t vectorized;
+		if (output != nullptr)
+		{
+			vectorized = simd::base85Decode<Base85Coder>(simdLevel(), input + position
+					, size - position, output + result.written);
+		}
+		else
+		{
+			vectorized = simd::base85Decode<Base85Coder>(simdLevel(), input + position
+					, std::min(size - position, indexBufferSize * scratchGroups)
+					, scratch.data());
+		}
+		position += vectorized;
+		result.written += vectorized / indexBufferSize * inputBufferSize;
+
+		if constexpr (zeroGroup != 0)
+		{
+			if (position != size && input[position] == zeroGroup)
+			{
+				if (output != nullptr)
+				{
+					std::fill(output + result.written
+							, output + result.written + inputBufferSize, std::uint8_t{ 0 });
+				}
+				++position;
+				result.written += inputBufferSize;
+				continue;
+			}
+		}
+		if (size - position < indexBufferSize)
+		{
+			break;
+		}
+
+		std::uint32_t value;
+		const std::size_t offset = decodeGroup<CHECKED>(input + position, indexBufferSize
+				, value);
+		if (offset != indexBufferSize)
+		{
+			result.status = DecodeStatus::InvalidCharacter;
+			position += offset;
+			return result;
+		}
+		if (output != nullptr)
+		{
+			output[result.written] = static_cast<std::uint8_t>(value >> 24);
+			output[result.written + 1] = static_cast<std::uint8_t>(value >> 16);
+			output[result.written + 2] = static_cast<std::uint8_t>(value >> 8);
+			output[result.written + 3] = static_cast<std::uint8_t>(value);
+		}
+		position += indexBufferSize;
+		result.written += inputBufferSize;
+	}
+	return result;
+}
+
+template<typename Trait>
+template<bool CHECKED>
+std::size_t Base85Coder<Trait>::decodeGroup(const AlphabetType *input, std::size_t size
+		, std::uint32_t &value)
+{
+	std::uint64_t wide = 0;
+	for (std::size_t i = 0; i != indexBufferSize; ++i)
+	{
+		std::uint8_t digit = alphabetSize - 1;
+		if (i < size)
+		{
+			digit = reverseAlphabet[static_cast<std::uint8_t>(input[i])];
+			if (digit >= alphabetSize)
+			{
+				if constexpr (CHECKED)
+				{
+					return i;
+				}
+				digit = 0;
+			}
+		}
+		wide = wide * alphabetSize + digit;
+	}
+	if constexpr (CHECKED)
+	{
+		if (wide > 0xFFFFFFFFu)
+		{
+			return 0;
+		}
+	}
+	value = static_cast<std::uint32_t>(wide);
+	return size;
+}
+
+template<typename Trait>
+template<bool CHECKED>
+DecodeResult Base85Coder<Trait>::checkedDecode(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
+{
+	DecodeResult result = decodeGroups<CHECKED>(input, size, output);
+	const std::size_t tailSize = size - result.errorOffset;
+	if (!result || tailSize == 0)
+	{
+		return result;
+	}
+	if (tailSize == 1)
+	{
+		if constexpr (CHECKED)
+		{
+			result.status = DecodeStatus::InvalidLength;
+			return result;
+		}
+		result.errorOffset = size;
+		return result;
+	}
+
+	// padding by the last digit rounds value up, dropped bytes take the rest
+	std::uint32_t value;
+	const std::size_t offset = decodeGroup<CHECKED>(input + result.errorOffset, tailSize
+			, value);
+	if (offset != tailSize)
+	{
+		result.status = DecodeStatus::InvalidCharacter;
+		result.errorOffset += offset;
+		return result;
+	}
+	if (output != nullptr)
+	{
+		for (std::size_t i = 0; i != tailSize - 1; ++i)
+		{
+			output[result.written + i] = static_cast<std::uint8_t>(value >> (24 - i * CHAR_BIT));
+		}
+	}
+	result.errorOffset = size;
+	result.written += tailSize - 1;
+	return result;
+}
+
+} // namespace base_coder
+
+#endif // BASECODER_BASE85_HPP
@@ -4,14 +4,48 @@
 #include <BaseCoder/Traits.hpp>
 #include <BaseCoder/View.hpp>
 #include <BaseCoder/Meta.hpp>
+#include <BaseCoder/Simd.hpp>
+#include <BaseCoder/Swar.hpp>
 
 #include <functional>
 #include <utility>
 #include <array>
+#include <cstddef>
+#include <cstring>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
 
 namespace base_coder
 {
 
+///
+/// \brief The DecodeStatus enum
+///
+enum class DecodeStatus
+{
+	Ok, ///<
+	InvalidCharacter, ///< character outside of alphabet
+	InvalidPadding, ///< pad inside data, wrong count of pad or pad against Trait::padding
+	InvalidLength ///< count of characters in the last block can't be decoded
+};
+
+///
+/// \brief The DecodeResult struct
+///
+struct DecodeResult
+{
+	DecodeStatus status = DecodeStatus::Ok; ///<
+	std::size_t errorOffset = 0; ///< offset of the first bad character, input size if Ok
+	std::size_t written = 0; ///< count of decoded bytes, only whole valid blocks on error
+
+	explicit operator bool() const
+	{
+		return status == DecodeStatus::Ok;
+	}
+};
+
 ///
 /// \brief The BaseCoder class
 /// \tparam Trait
@@ -24,10 +58,12 @@ public:
 
 	static constexpr auto type = Trait::type;
 	static constexpr auto subtype = Trait::subtype;
+	static constexpr auto padding = Trait::padding;
 	static constexpr auto alphabet = Trait::alphabet;
 	static constexpr auto alphabetSize = Trait::alphabetSize;
 	static constexpr auto pad = Trait::pad;
 	static constexpr auto indexBitSize = Trait::indexBitSize;
+	static constexpr auto reverseAlphabet = Trait::reverseAlphabet;
 
 	static constexpr auto indexBufferSize = Trait::indexBufferSize;
 	static constexpr auto indexBufferSizeInBits = Trait::indexBufferSizeInBits;
@@ -69,6 +105,13 @@ public:
 	template<typename Container>
 	size_t decodeSize(const Container &inputView) const;
 
+	///
+	/// \brief upperBoundDecodeSize
+	/// \param encodedSize count of encoded characters
+	/// \return maximal count of decoded bytes, without looking at data
+	///
+	static constexpr size_t upperBoundDecodeSize(size_t encodedSize);
+
 	///
 	/// \brief encode
 	/// \tparam InputIterator
@@ -111,6 +154,99 @@ public:
 	template<typename Container, typename OutputIterator>
 	void decode(const Container &container, OutputIterator outputIterator) const;
 
+	///
+	/// \brief encode contiguous data without intermediate buffers
+	/// \param input
+	/// \param size count of input bytes
+	/// \param output buffer for encodeSize characters
+	/// \return count of written characters
+	///
+	std::size_t encode(const std::uint8_t *input, std::size_t size
+			, AlphabetType *output) const;
+
+	///
+	/// \brief decode contiguous data without intermediate buffers
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for decoded bytes, may be input itself
+	/// \return count of written bytes
+	///
+	std::size_t decode(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+
+	///
+	/// \brief decodeInPlace: decode over the front of encoded data
+	/// \param data
+	/// \param size count of encoded characters
+	/// \return count of decoded bytes at the begin of data
+	///
+	std::size_t decodeInPlace(AlphabetType *data, std::size_t size) const;
+
+#if defined(__cpp_lib_span)
+	///
+	/// \brief encode contiguous data without intermediate buffers
+	/// \param input
+	/// \param output buffer for encodeSize characters
+	/// \return count of written characters
+	///
+	std::size_t encode(std::span<const std::byte> input
+			, std::span<AlphabetType> output) const;
+
+	///
+	/// \brief decode contiguous data without intermediate buffers
+	/// \param input
+	/// \param output buffer for decoded bytes
+	/// \return count of written bytes
+	///
+	std::size_t decode(std::span<const AlphabetType> input
+			, std::span<std::byte> output) const;
+
+	///
+	/// \brief decodeInPlace: decode over the front of encoded data
+	/// \param data
+	/// \return count of decoded bytes at the begin of data
+	///
+	std::size_t decodeInPlace(std::span<AlphabetType> data) const;
+#endif
+
+	///
+	/// \brief decodeChecked: decode contiguous data validating it in the same pass
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for decodeSize bytes, may be input itself
+	/// \return status, offset of the first bad character and count of written bytes
+	///
+	DecodeResult decodeChecked(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+
+	///
+	/// \brief validate
+	/// \param input
+	/// \param size count of input characters
+	/// \return status, offset of the first bad character and count of bytes
+	/// which decodeChecked would write
+	///
+	DecodeResult validate(const AlphabetType *input, std::size_t size) const;
+
+#if defined(__cpp_lib_span)
+	///
+	/// \brief decodeChecked: decode contiguous data validating it in the same pass
+	/// \param input
+	/// \param output buffer for decodeSize bytes
+	/// \return status, offset of the first bad character and count of written bytes
+	///
+	DecodeResult decodeChecked(std::span<const AlphabetType> input
+			, std::span<std::byte> output) const;
+
+	///
+	/// \brief validate
+	/// \param input
+	/// \return status, offset of the first bad character and count of bytes
+	/// which decodeChecked would write
+	///
+	DecodeResult validate(std::span<const AlphabetType> input) const;
+#endif
+
 protected:
 	using Buffer = NumberType<indexBufferSizeInBits>;
 
@@ -119,63 +255,118 @@ protected:
 	using DecodeInput = EncodeOutput;
 	using DecodeOutput = EncodeInput;
 
+	///
+	/// \brief Count of blocks buffered by iterator based encode/decode
+	///
+	static constexpr std::size_t stagingBlocks = 256;
+
+	///
+	/// \brief encodedSize
+	/// \param size count of input bytes
+	/// \return count of encoded characters including pad, if padding allows it
+	///
+	static constexpr std::size_t encodedSize(std::size_t size);
+
+	///
+	/// \brief encodeTail: encode the last incomplete block, pad is written
+	/// unless padding is forbidden
+	/// \param input
+	/// \param size count of input bytes, less than inputBufferSize
+	/// \param output buffer for indexBufferSize characters
+	/// \return count of written characters
+	///
+	std::size_t encodeTail(const std::uint8_t *input, std::size_t size
+			, AlphabetType *output) const;
+
+	///
+	/// \brief decodeTail: decode the last block, trailing pad is skipped
+	/// \param input
+	/// \param size count of input characters, at most indexBufferSize
+	/// \param output buffer for inputBufferSize bytes
+	/// \return count of written bytes
+	///
+	std::size_t decodeTail(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+
+	///
+	/// \brief encodeBlocks
+	/// \param input
+	/// \param size count of input bytes, multiple of inputBufferSize
+	/// \param output
+	/// \return count of written characters
+	///
+	std::size_t encodeBlocks(const std::uint8_t *input, std::size_t size
+			, AlphabetType *output) const;
+
+	///
+	/// \brief decodeBlocks
+	/// \param input
+	/// \param size count of input characters, multiple of indexBufferSize
+	/// \param output
+	/// \return count of written bytes
+	///
+	std::size_t decodeBlocks(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+
 	///
 	/// \brief coreEncode
 	/// \param data
+	/// \param size count of significant bytes in data
 	/// \return
 	///
-	EncodeOutput coreEncode(EncodeInput data) const;
+	constexpr EncodeOutput coreEncode(EncodeInput data
+			, std::size_t size = inputBufferSize) const;
 
 	///
 	/// \brief coreDecode
 	/// \param data
 	/// \return
 	///
-	DecodeOutput coreDecode(DecodeInput data) const;
+	constexpr DecodeOutput coreDecode(DecodeInput data) const;
 
 private:
 	///
-	/// \brief The FakeIterator class
-	/// \tparam T
-	/// \tparam Callable
-	///
-	template<typename T, typename Callable>
-	class FakeIterator
-	{
-	public:
-		///
-		/// \brief Constructtor
-		/// \param callable
-		///
-		FakeIterator(Callable &&callable);
-
-		///
-		/// \brief operator*
-		/// \return
-		///
-		T &operator*();
-
-		///
-		/// \brief operator++
-		/// \return
-		///
-		FakeIterator<T, Callable> &operator++();
-
-	private:
-		T t{}; ///<
-		Callable call; ///<
-	};
+	/// \brief encodeContiguous
+	/// \tparam OutputIterator
+	/// \param input
+	/// \param size count of input bytes
+	/// \param outputIterator
+	///
+	template<typename OutputIterator>
+	void encodeContiguous(const std::uint8_t *input, std::size_t size
+			, OutputIterator outputIterator) const;
 
+	///
+	/// \brief decodeContiguous
+	/// \tparam OutputIterator
+	/// \param input
+	/// \param size count of input characters
+	/// \param outputIterator
+	///
+	template<typename OutputIterator>
+	void decodeContiguous(const AlphabetType *input, std::size_t size
+			, OutputIterator outputIterator) const;
 
 	///
-	/// \brief makeFakeIterator
-	/// \param callable
+	/// \brief checkedDecode: common part of decodeChecked and validate
+	/// \tparam WRITE write decoded bytes to output
+	/// \param input
+	/// \param size count of input characters
+	/// \param output
 	/// \return
 	///
-	template<typename T, typename Callable>
-	static FakeIterator<T, Callable> makeFakeIterator(T, Callable &&callable);
+	template<bool WRITE>
+	DecodeResult checkedDecode(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+
+	///
+	/// \brief findInvalid
+	/// \param input
+	/// \param size count of input characters
+	/// \return result with offset of the first pad or invalid character, Ok if there is none
+	///
+	static DecodeResult findInvalid(const AlphabetType *input, std::size_t size);
 
-private:
 	///
 	/// \brief checkIteratorType
 	/// \tparam Iterator
@@ -189,7 +380,7 @@ private:
 	/// \return inited CodeContainer object
 	///
 	template<typename CodeContainer>
-	CodeContainer makeCodeContainer() const;
+	constexpr CodeContainer makeCodeContainer() const;
 };
 
 using Base64 = BaseCoder<Base64Traits>;
@@ -197,6 +388,16 @@ using Base64Hex = BaseCoder<Base64HexTraits>;
 using Base32 = BaseCoder<Base32Traits>;
 using Base32Hex = BaseCoder<Base32HexTraits>;
 using Base16 = BaseCoder<Base16Traits>;
+using Base16Lower = BaseCoder<Base16LowerTraits>;
+
+using Base64HexUnpadded = BaseCoder<Base64HexUnpaddedTraits>;
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+using Base32Crockford = BaseCoder<Base32CrockfordTraits>;
+using ZBase32 = BaseCoder<ZBase32Traits>;
+using Base64Bcrypt = BaseCoder<Base64BcryptTraits>;
+using Base64Imap = BaseCoder<Base64ImapTraits>;
+#endif
 
 }
 
@@ -209,14 +410,7 @@ size_t BaseCoder<Trait>::encodeSize(View<InputIterator> inputView) const
 {
 	checkIteratorType<InputIterator>();
 
-	constexpr size_t encodeInputSize = EncodeInput{}.size();
-	constexpr size_t encodeOutputSize = EncodeOutput{}.size();
-
-	const size_t inputViewSize = inputView.size();
-	size_t size = ( (inputViewSize / encodeInputSize)
-			+ (inputViewSize % encodeInputSize != 0) )
-			* encodeOutputSize;
-	return size;
+	return encodedSize(inputView.size());
 }
 
 template<typename Trait>
@@ -232,37 +426,31 @@ size_t BaseCoder<Trait>::decodeSize(View<InputIterator> inputView) const
 {
 	checkIteratorType<InputIterator>();
 
-	constexpr size_t decodeInputSize = DecodeInput{}.size();
-	constexpr size_t decodeOutputSize = DecodeOutput{}.size();
-
-	const size_t inputViewSize = inputView.size();
-	const size_t countBlocks = inputViewSize / decodeInputSize;
-	const size_t lastBlockPosition = (countBlocks ? countBlocks - 1 : 0)
-			* decodeInputSize;
-
-	InputIterator it = inputView.begin();
+	// only trailing pad characters change size of decoded data
+	size_t size = 0;
+	size_t padSize = 0;
 	if constexpr (std::is_same_v<
 		typename std::iterator_traits<InputIterator>::iterator_category
 		, std::random_access_iterator_tag>)
 	{
-		it += lastBlockPosition;
+		size = inputView.size();
+		InputIterator it = inputView.end();
+		while (padSize < size && padSize < indexBufferSize
+				&& *(--it) == pad)
+		{
+			++padSize;
+		}
 	}
 	else
 	{
-		for (auto i = lastBlockPosition; i != 0; --i)
+		for (auto i : inputView)
 		{
-			++it;
+			++size;
+			padSize = (i == pad) ? padSize + 1 : 0;
 		}
 	}
-
-	size_t size = ((inputViewSize ? inputViewSize : decodeInputSize)
-			/ decodeInputSize - 1) * decodeOutputSize;
-
-	// decode last block
-	decode(View<InputIterator>{ it, inputView.end() }
-			, makeFakeIterator(size, [&size](){ ++size; }));
-
-	return size;
+	return (size - padSize) / indexBufferSize * inputBufferSize
+			+ (size - padSize) % indexBufferSize * indexBitSize / CHAR_BIT;
 }
 
 template<typename Trait>
@@ -281,24 +469,39 @@ void BaseCoder<Trait>::encode(View<InputIterator> inputView
 	checkIteratorType<InputIterator>();
 	//checkIteratorType<OutputIterator>();
 
-	EncodeInput encodeInput = makeCodeContainer<EncodeInput>();
-	uint8_t encodeInputIndex = 0;
+	if constexpr (View<InputIterator>::isContiguous)
+	{
+		encodeContiguous(reinterpret_cast<const std::uint8_t *>(inputView.data())
+				, inputView.size(), outputIterator);
+		return;
+	}
+
+	std::array<std::uint8_t, inputBufferSize * stagingBlocks> input{};
+	std::array<AlphabetType, indexBufferSize * stagingBlocks> output;
+	std::size_t inputIndex = 0;
 	for (auto i : inputView)
 	{
-		encodeInput[encodeInputIndex++] = i;
+		input[inputIndex++] = i;
 
-		if (encodeInputIndex == encodeInput.size())
+		if (inputIndex == input.size())
 		{
-			encodeInputIndex = 0;
-			EncodeOutput encodeOutput = coreEncode(encodeInput);
-			std::copy(encodeOutput.begin(), encodeOutput.end(), outputIterator);
-			encodeInput = makeCodeContainer<EncodeInput>();
+			inputIndex = 0;
+			const std::size_t written = encodeBlocks(input.data(), input.size()
+					, output.data());
+			outputIterator = std::copy(output.data(), output.data() + written
+					, outputIterator);
 		}
 	}
-	if (encodeInputIndex)
+
+	const std::size_t tailSize = inputIndex % inputBufferSize;
+	const std::size_t written = encodeBlocks(input.data(), inputIndex - tailSize
+			, output.data());
+	outputIterator = std::copy(output.data(), output.data() + written, outputIterator);
+	if (tailSize)
 	{
-		EncodeOutput encodeOutput = coreEncode(encodeInput);
-		std::copy(encodeOutput.begin(), encodeOutput.end(), outputIterator);
+		const std::size_t tailWritten = encodeTail(input.data() + inputIndex - tailSize
+				, tailSize, output.data());
+		std::copy(output.data(), output.data() + tailWritten, outputIterator);
 	}
 }
 
@@ -318,27 +521,35 @@ void BaseCoder<Trait>::decode(View<InputIterator> inputView
 	checkIteratorType<InputIterator>();
 	//checkIteratorType<OutputIterator>();
 
-	DecodeInput decodeInput = makeCodeContainer<DecodeInput>();
-	uint8_t decodeInputIndex = 0;
+	if constexpr (View<InputIterator>::isContiguous)
+	{
+		decodeContiguous(reinterpret_cast<const AlphabetType *>(inputView.data())
+				, inputView.size(), outputIterator);
+		return;
+	}
+
+	std::array<AlphabetType, indexBufferSize * stagingBlocks> input{};
+	std::array<std::uint8_t, inputBufferSize * stagingBlocks> output;
+	std::size_t inputIndex = 0;
 	for (auto i : inputView)
 	{
-		decodeInput[decodeInputIndex++] = i;
+		input[inputIndex++] = i;
 
-		if (decodeInputIndex == decodeInput.size())
+		if (inputIndex == input.size())
 		{
-			decodeInputIndex = 0;
-			DecodeOutput decodeOutput = coreDecode(decodeInput);
-			std::copy_if(decodeOutput.begin(), decodeOutput.end(), outputIterator
-					, [](auto i) { return i != 0; });
-			decodeInput = makeCodeContainer<DecodeInput>();
+			// the last block may be padded, so it waits for the end of input
+			inputIndex = input.size() - indexBufferSize;
+			const std::size_t written = decodeBlocks(input.data(), inputIndex
+					, output.data());
+			outputIterator = std::copy(output.data(), output.data() + written
+					, outputIterator);
+			std::copy(input.begin() + inputIndex, input.end(), input.begin());
+			inputIndex = indexBufferSize;
 		}
 	}
-	if (decodeInputIndex)
-	{
-		DecodeOutput encodeOutput = coreDecode(decodeInput);
-		std::copy_if(encodeOutput.begin(), encodeOutput.end(), outputIterator
-				, [](auto i) { return i != 0; });
-	}
+
+	const std::size_t written = decode(input.data(), inputIndex, output.data());
+	std::copy(output.data(), output.data() + written, outputIterator);
 }
 
 template<typename Trait>
@@ -349,38 +560,345 @@ void BaseCoder<Trait>::decode(const Container &container
 	decode(makeView(std::cref(container)), outputIterator);
 }
 
-// private
+template<typename Trait>
+std::size_t BaseCoder<Trait>::encode(const std::uint8_t *input, std::size_t size
+		, AlphabetType *output) const
+{
+	const std::size_t tailSize = size % inputBufferSize;
+	std::size_t written = encodeBlocks(input, size - tailSize, output);
+	if (tailSize)
+	{
+		written += encodeTail(input + size - tailSize, tailSize, output + written);
+	}
+	return written;
+}
+
+template<typename Trait>
+std::size_t BaseCoder<Trait>::decode(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
+{
+	// last block may be padded or incomplete
+	std::size_t tailSize = size % indexBufferSize;
+	if (tailSize == 0 && size)
+	{
+		tailSize = indexBufferSize;
+	}
+	std::size_t written = decodeBlocks(input, size - tailSize, output);
+	if (tailSize)
+	{
+		written += decodeTail(input + size - tailSize, tailSize, output + written);
+	}
+	return written;
+}
+
+template<typename Trait>
+std::size_t BaseCoder<Trait>::decodeInPlace(AlphabetType *data, std::size_t size) const
+{
+	// every block shrinks and kernels store only over characters they have loaded,
+	// so writes never pass reads
+	return decode(data, size, reinterpret_cast<std::uint8_t *>(data));
+}
+
+template<typename Trait>
+constexpr size_t BaseCoder<Trait>::upperBoundDecodeSize(size_t encodedSize)
+{
+	return encodedSize / indexBufferSize * inputBufferSize
+			+ encodedSize % indexBufferSize * indexBitSize / CHAR_BIT;
+}
+
+#if defined(__cpp_lib_span)
+template<typename Trait>
+std::size_t BaseCoder<Trait>::encode(std::span<const std::byte> input
+		, std::span<AlphabetType> output) const
+{
+	return encode(reinterpret_cast<const std::uint8_t *>(input.data()), input.size()
+			, output.data());
+}
+
+template<typename Trait>
+std::size_t BaseCoder<Trait>::decode(std::span<const AlphabetType> input
+		, std::span<std::byte> output) const
+{
+	return decode(input.data(), input.size()
+			, reinterpret_cast<std::uint8_t *>(output.data()));
+}
+
+template<typename Trait>
+std::size_t BaseCoder<Trait>::decodeInPlace(std::span<AlphabetType> data) const
+{
+	return decodeInPlace(data.data(), data.size());
+}
+#endif
+
+template<typename Trait>
+DecodeResult BaseCoder<Trait>::decodeChecked(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
+{
+	return checkedDecode<true>(input, size, output);
+}
+
+template<typename Trait>
+DecodeResult BaseCoder<Trait>::validate(const AlphabetType *input, std::size_t size) const
+{
+	return checkedDecode<false>(input, size, nullptr);
+}
+
+#if defined(__cpp_lib_span)
+template<typename Trait>
+DecodeResult BaseCoder<Trait>::decodeChecked(std::span<const AlphabetType> input
+		, std::span<std::byte> output) const
+{
+	return decodeChecked(input.data(), input.size()
+			, reinterpret_cast<std::uint8_t *>(output.data()));
+}
+
+template<typename Trait>
+DecodeResult BaseCoder<Trait>::validate(std::span<const AlphabetType> input) const
+{
+	return validate(input.data(), input.size());
+}
+#endif
+
+// protected
+
+template<typename Trait>
+constexpr std::size_t BaseCoder<Trait>::encodedSize(std::size_t size)
+{
+	if constexpr (padding == Padding::Forbidden)
+	{
+		return size / inputBufferSize * indexBufferSize
+				+ (size % inputBufferSize * CHAR_BIT + indexBitSize - 1) / indexBitSize;
+	}
+	else
+	{
+		return (size / inputBufferSize + (size % inputBufferSize != 0)) * indexBufferSize;
+	}
+}
+
+template<typename Trait>
+std::size_t BaseCoder<Trait>::encodeTail(const std::uint8_t *input, std::size_t size
+		, AlphabetType *output) const
+{
+	constexpr Buffer BASE_BIT_MASK = uppedMask<indexBitSize>;
+
+	Buffer buffer = 0;
+	for (std::size_t i = 0; i != size; ++i)
+	{
+		buffer |= static_cast<Buffer>(static_cast<Buffer>(input[i])
+				<< (CHAR_BIT * (inputBufferSize - i - 1)));
+	}
 
-// FakeIterator
+	const std::size_t significantSize = (size * CHAR_BIT + indexBitSize - 1) / indexBitSize;
+	for (std::size_t i = 0; i != significantSize; ++i)
+	{
+		output[i] = alphabet[(buffer >> (indexBitSize * (indexBufferSize - i - 1)))
+				& BASE_BIT_MASK];
+	}
+	if constexpr (padding == Padding::Forbidden)
+	{
+		return significantSize;
+	}
+	else
+	{
+		std::fill(output + significantSize, output + indexBufferSize, pad);
+		return indexBufferSize;
+	}
+}
 
 template<typename Trait>
-template<typename T, typename Callable>
-BaseCoder<Trait>::FakeIterator<T, Callable>::FakeIterator(Callable &&callable)
-		: call{ std::move(callable) }
-{}
+std::size_t BaseCoder<Trait>::decodeTail(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
+{
+	while (size && input[size - 1] == pad)
+	{
+		--size;
+	}
+
+	// invalid characters are decoded as zero bits
+	Buffer buffer = 0;
+	for (std::size_t i = 0; i != size; ++i)
+	{
+		const std::uint8_t index = reverseAlphabet[static_cast<std::uint8_t>(input[i])];
+		buffer |= static_cast<Buffer>(static_cast<Buffer>((index < alphabetSize) ? index : 0)
+				<< (indexBitSize * (indexBufferSize - i - 1)));
+	}
+
+	const std::size_t byteSize = size * indexBitSize / CHAR_BIT;
+	for (std::size_t i = 0; i != byteSize; ++i)
+	{
+		output[i] = static_cast<std::uint8_t>(buffer >> (CHAR_BIT * (inputBufferSize - i - 1)));
+	}
+	return byteSize;
+}
+
+// private
+
+template<typename Trait>
+template<typename OutputIterator>
+void BaseCoder<Trait>::encodeContiguous(const std::uint8_t *input, std::size_t size
+		, OutputIterator outputIterator) const
+{
+	if constexpr (std::is_same_v<OutputIterator, AlphabetType *>)
+	{
+		encode(input, size, outputIterator);
+	}
+	else
+	{
+		constexpr std::size_t chunkSize = inputBufferSize * stagingBlocks;
+		std::array<AlphabetType, indexBufferSize * stagingBlocks> output;
+		std::size_t position = 0;
+		for (; size - position > chunkSize; position += chunkSize)
+		{
+			const std::size_t written = encodeBlocks(input + position, chunkSize
+					, output.data());
+			outputIterator = std::copy(output.data(), output.data() + written
+					, outputIterator);
+		}
+		const std::size_t written = encode(input + position, size - position
+				, output.data());
+		std::copy(output.data(), output.data() + written, outputIterator);
+	}
+}
 
 template<typename Trait>
-template<typename T, typename Callable>
-T &BaseCoder<Trait>::FakeIterator<T, Callable>::operator*()
+template<typename OutputIterator>
+void BaseCoder<Trait>::decodeContiguous(const AlphabetType *input, std::size_t size
+		, OutputIterator outputIterator) const
 {
-	call();
-	return t;
+	if constexpr (std::is_same_v<OutputIterator, std::uint8_t *>)
+	{
+		decode(input, size, outputIterator);
+	}
+	else
+	{
+		// the last chunk may be padded, so it is decoded with tail
+		constexpr std::size_t chunkSize = indexBufferSize * stagingBlocks;
+		std::array<std::uint8_t, inputBufferSize * stagingBlocks> output;
+		std::size_t position = 0;
+		for (; size - position > chunkSize; position += chunkSize)
+		{
+			const std::size_t written = decodeBlocks(input + position, chunkSize
+					, output.data());
+			outputIterator = std::copy(output.data(), output.data() + written
+					, outputIterator);
+		}
+		const std::size_t written = decode(input + position, size - position
+				, output.data());
+		std::copy(output.data(), output.data() + written, outputIterator);
+	}
 }
 
 template<typename Trait>
-template<typename T, typename Callable>
-typename BaseCoder<Trait>::template FakeIterator<T, Callable> &
-BaseCoder<Trait>::FakeIterator<T, Callable>::operator++()
+template<bool WRITE>
+DecodeResult BaseCoder<Trait>::checkedDecode(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
 {
-	return *this;
+	std::size_t padSize = 0;
+	while (padSize < size && input[size - padSize - 1] == pad)
+	{
+		++padSize;
+	}
+	const std::size_t dataSize = size - padSize;
+	const std::size_t wholeSize = dataSize - dataSize % indexBufferSize;
+
+	// kernels stop before the first vector with pad or invalid character,
+	// the rest is checked by table while decoding
+	std::size_t position = 0;
+	if constexpr (WRITE)
+	{
+		position = simd::Kernels<Trait>::decode(simdLevel(), input, wholeSize, output);
+	}
+	else
+	{
+		position = simd::Kernels<Trait>::validate(simdLevel(), input, wholeSize);
+		position -= position % indexBufferSize;
+	}
+	for (; position != wholeSize; position += indexBufferSize)
+	{
+		if constexpr (WRITE)
+		{
+			position += swar::decode<Trait>(input + position, wholeSize - position
+					, output + position / indexBufferSize * inputBufferSize);
+			if (position == wholeSize)
+			{
+				break;
+			}
+		}
+
+		DecodeResult result = findInvalid(input + position, indexBufferSize);
+		if (!result)
+		{
+			result.errorOffset += position;
+			result.written = position / indexBufferSize * inputBufferSize;
+			return result;
+		}
+		if constexpr (WRITE)
+		{
+			DecodeInput decodeInput;
+			std::memcpy(decodeInput.data(), input + position, indexBufferSize);
+			const DecodeOutput decodeOutput = coreDecode(decodeInput);
+			std::copy(decodeOutput.begin(), decodeOutput.end()
+					, output + position / indexBufferSize * inputBufferSize);
+		}
+	}
+
+	DecodeResult result = findInvalid(input + wholeSize, dataSize - wholeSize);
+	result.written = wholeSize / indexBufferSize * inputBufferSize;
+	if (!result)
+	{
+		result.errorOffset += wholeSize;
+		return result;
+	}
+
+	// the last block must be a prefix of encoded block, padded up to whole one
+	const std::size_t tailSize = dataSize - wholeSize;
+	const std::size_t tailBytes = tailSize * indexBitSize / CHAR_BIT;
+	if (tailSize != (tailBytes * CHAR_BIT + indexBitSize - 1) / indexBitSize)
+	{
+		result.status = DecodeStatus::InvalidLength;
+		result.errorOffset = dataSize;
+		return result;
+	}
+	if (padSize && (tailSize == 0 || padSize != indexBufferSize - tailSize
+			|| padding == Padding::Forbidden))
+	{
+		result.status = DecodeStatus::InvalidPadding;
+		result.errorOffset = dataSize;
+		return result;
+	}
+	if (padding == Padding::Required && tailSize && padSize == 0)
+	{
+		result.status = DecodeStatus::InvalidPadding;
+		result.errorOffset = size;
+		return result;
+	}
+
+	if constexpr (WRITE)
+	{
+		decodeTail(input + wholeSize, tailSize, output + result.written);
+	}
+	result.written += tailBytes;
+	result.errorOffset = size;
+	return result;
 }
 
 template<typename Trait>
-template<typename T, typename Callable>
-typename BaseCoder<Trait>::template FakeIterator<T, Callable>
-BaseCoder<Trait>::makeFakeIterator(T, Callable &&callable)
+DecodeResult BaseCoder<Trait>::findInvalid(const AlphabetType *input, std::size_t size)
 {
-	return FakeIterator<T, Callable>(std::move(callable));
+	DecodeResult result;
+	for (std::size_t i = 0; i != size; ++i)
+	{
+		const std::uint8_t index = reverseAlphabet[static_cast<std::uint8_t>(input[i])];
+		if (index >= alphabetSize)
+		{
+			result.status = (index == Trait::padIndex)
+					? DecodeStatus::InvalidPadding
+					: DecodeStatus::InvalidCharacter;
+			result.errorOffset = i;
+			break;
+		}
+	}
+	return result;
 }
 
 // BaseCoder
@@ -389,24 +907,56 @@ template<typename Trait>
 template<typename Iterator>
 constexpr void BaseCoder<Trait>::checkIteratorType()
 {
-	using IteratorReturnType = std::remove_cv_t< std::remove_reference_t<
-		decltype(*std::declval<Iterator>())
-	> >;
-	static_assert(std::is_same_v<AlphabetType, IteratorReturnType>
-			|| std::is_same_v<std::make_signed_t<AlphabetType>, IteratorReturnType>
-			|| std::is_same_v<std::make_unsigned_t<AlphabetType>, IteratorReturnType>
-			, ""
-	);
+	detail::checkIteratorType<AlphabetType, Iterator>();
 }
 
 
 template<typename Trait>
-typename BaseCoder<Trait>::EncodeOutput
-BaseCoder<Trait>::coreEncode(EncodeInput data) const
+std::size_t BaseCoder<Trait>::encodeBlocks(const std::uint8_t *input, std::size_t size
+		, AlphabetType *output) const
+{
+	const std::size_t position = simd::Kernels<Trait>::encode(simdLevel(), input, size
+			, output);
+	swar::encode<Trait>(input + position, size - position
+			, output + position / inputBufferSize * indexBufferSize);
+	return size / inputBufferSize * indexBufferSize;
+}
+
+template<typename Trait>
+std::size_t BaseCoder<Trait>::decodeBlocks(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
+{
+	std::size_t position = simd::Kernels<Trait>::decode(simdLevel(), input, size, output);
+	while (position != size)
+	{
+		position += swar::decode<Trait>(input + position, size - position
+				, output + position / indexBufferSize * inputBufferSize);
+		if (position == size)
+		{
+			break;
+		}
+
+		// block with pad or invalid character
+		DecodeInput decodeInput;
+		std::memcpy(decodeInput.data(), input + position, indexBufferSize);
+		DecodeOutput decodeOutput = coreDecode(decodeInput);
+		std::copy(decodeOutput.begin(), decodeOutput.end()
+				, output + position / indexBufferSize * inputBufferSize);
+		position += indexBufferSize;
+	}
+	return size / indexBufferSize * inputBufferSize;
+}
+
+template<typename Trait>
+constexpr typename BaseCoder<Trait>::EncodeOutput
+BaseCoder<Trait>::coreEncode(EncodeInput data, std::size_t size) const
 {
 	constexpr Buffer BASE_BIT_MASK = uppedMask<indexBitSize>;
 
-	EncodeOutput output;
+	// characters after the last significant bit are pad
+	const std::size_t significantSize = (size * CHAR_BIT + indexBitSize - 1) / indexBitSize;
+
+	EncodeOutput output{};
 	Buffer buffer = 0;
 	auto dataView = View<decltype(data.begin())>{ data.begin(), data.end() - 1 };
 	for (auto i : dataView)
@@ -422,7 +972,7 @@ BaseCoder<Trait>::coreEncode(EncodeInput data) const
 		Buffer currentMask = BASE_BIT_MASK << shift;
 
 		const Buffer resultIndex = (buffer & currentMask) >> shift;
-		output[i] = (resultIndex != 0)
+		output[i] = (i < significantSize)
 				? alphabet[resultIndex]
 				: pad;
 	}
@@ -431,26 +981,16 @@ BaseCoder<Trait>::coreEncode(EncodeInput data) const
 }
 
 template<typename Trait>
-typename BaseCoder<Trait>::DecodeOutput
+constexpr typename BaseCoder<Trait>::DecodeOutput
 BaseCoder<Trait>::coreDecode(DecodeInput data) const
 {
 	constexpr Buffer BASE_BIT_MASK = uppedMask<CHAR_BIT>;
 
+	// pad and invalid characters are decoded as zero bits
 	auto getIndex = [](auto value) -> uint8_t
 	{
-		if (value == pad)
-		{
-			return 0;
-		}
-		size_t index = 0;
-		for (; index < alphabetSize; ++index)
-		{
-			if (alphabet[index] == value)
-			{
-				return index;
-			}
-		}
-		return index;
+		const uint8_t index = reverseAlphabet[static_cast<uint8_t>(value)];
+		return (index < alphabetSize) ? index : 0;
 	};
 
 	Buffer buffer = 0;
@@ -473,9 +1013,9 @@ BaseCoder<Trait>::coreDecode(DecodeInput data) const
 
 template<typename Trait>
 template<typename CodeContainer>
-CodeContainer BaseCoder<Trait>::makeCodeContainer() const
+constexpr CodeContainer BaseCoder<Trait>::makeCodeContainer() const
 {
-	CodeContainer container;
+	CodeContainer container{};
 	for (auto &i : container)
 	{
 		i = std::remove_reference_t<decltype(i)>{};
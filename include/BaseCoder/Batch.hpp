@@ -0,0 +1,191 @@
+#ifndef BASECODER_BATCH_HPP
+#define BASECODER_BATCH_HPP
+
+#include <BaseCoder/BaseCoder.hpp>
+
+#include <iterator>
+
+namespace base_coder
+{
+
+///
+/// \brief encodeBatchSize
+/// \tparam Trait
+/// \tparam Inputs container of contiguous byte ranges (std::string, std::vector, View...)
+/// \param inputs
+/// \return count of characters in output arena
+///
+template<typename Trait, typename Inputs>
+std::size_t encodeBatchSize(const Inputs &inputs);
+
+///
+/// \brief decodeBatchSize
+/// \tparam Trait
+/// \tparam Inputs container of contiguous character ranges
+/// \param inputs
+/// \return count of bytes in output arena
+///
+template<typename Trait, typename Inputs>
+std::size_t decodeBatchSize(const Inputs &inputs);
+
+///
+/// \brief encodeBatch: encode many short inputs in one call
+/// \tparam Trait
+/// \tparam Inputs container of contiguous byte ranges
+/// \param inputs
+/// \param output arena for encodeBatchSize characters
+/// \param offsets array for inputs.size() + 1 values: offsets[i] is start of
+/// encoded input i in arena, the last one is total count of characters
+/// \return count of written characters
+///
+template<typename Trait, typename Inputs>
+std::size_t encodeBatch(const Inputs &inputs, typename Trait::AlphabetType *output
+		, std::size_t *offsets);
+
+///
+/// \brief decodeBatch: decode many short inputs in one call
+/// \tparam Trait
+/// \tparam Inputs container of contiguous character ranges
+/// \param inputs
+/// \param output arena for decodeBatchSize bytes
+/// \param offsets array for inputs.size() + 1 values: offsets[i] is start of
+/// decoded input i in arena, the last one is total count of bytes
+/// \return count of written bytes
+///
+template<typename Trait, typename Inputs>
+std::size_t decodeBatch(const Inputs &inputs, std::uint8_t *output
+		, std::size_t *offsets);
+
+namespace detail
+{
+
+///
+/// \brief batchData
+/// \return pointer to contiguous range as pointer to Element
+///
+template<typename Element, typename Input>
+const Element *batchData(const Input &input)
+{
+	static_assert(sizeof(*std::data(input)) == 1, "Batch input must be range of bytes");
+	return reinterpret_cast<const Element *>(std::data(input));
+}
+
+///
+/// \brief forEachRun: call callable(first, begin, end) for runs of inputs which
+/// are adjacent in memory and may be processed as one range [begin, end);
+/// every input except the last in run must satisfy isWhole(index, size)
+///
+template<typename Element, typename Inputs, typename IsWhole, typename Callable>
+void forEachRun(const Inputs &inputs, IsWhole &&isWhole, Callable &&callable)
+{
+	const std::size_t count = std::size(inputs);
+	auto input = std::begin(inputs);
+	for (std::size_t first = 0; first != count; )
+	{
+		const Element *begin = batchData<Element>(*input);
+		const Element *end = begin + std::size(*input);
+		std::size_t last = first + 1;
+		auto next = std::next(input);
+		for (; last != count && isWhole(last - 1, std::size(*input))
+				&& batchData<Element>(*next) == end; ++last)
+		{
+			end += std::size(*next);
+			input = next++;
+		}
+		callable(first, begin, end);
+		input = next;
+		first = last;
+	}
+}
+
+} // namespace detail
+
+template<typename Trait, typename Inputs>
+std::size_t encodeBatchSize(const Inputs &inputs)
+{
+	const BaseCoder<Trait> coder;
+	std::size_t size = 0;
+	for (const auto &input : inputs)
+	{
+		const std::uint8_t *data = detail::batchData<std::uint8_t>(input);
+		size += coder.encodeSize(View(data, data + std::size(input)));
+	}
+	return size;
+}
+
+template<typename Trait, typename Inputs>
+std::size_t decodeBatchSize(const Inputs &inputs)
+{
+	const BaseCoder<Trait> coder;
+	std::size_t size = 0;
+	for (const auto &input : inputs)
+	{
+		const auto *data = detail::batchData<typename Trait::AlphabetType>(input);
+		size += coder.decodeSize(View(data, data + std::size(input)));
+	}
+	return size;
+}
+
+template<typename Trait, typename Inputs>
+std::size_t encodeBatch(const Inputs &inputs, typename Trait::AlphabetType *output
+		, std::size_t *offsets)
+{
+	const BaseCoder<Trait> coder;
+	std::size_t index = 0;
+	offsets[0] = 0;
+	for (const auto &input : inputs)
+	{
+		const std::uint8_t *data = detail::batchData<std::uint8_t>(input);
+		offsets[index + 1] = offsets[index]
+				+ coder.encodeSize(View(data, data + std::size(input)));
+		++index;
+	}
+
+	// inputs without tail encode to the same characters when joined
+	detail::forEachRun<std::uint8_t>(inputs
+			, [](std::size_t, std::size_t size)
+			{
+				return size % Trait::inputBufferSize == 0;
+			}
+			, [&](std::size_t first, const std::uint8_t *begin, const std::uint8_t *end)
+			{
+				coder.encode(begin, end - begin, output + offsets[first]);
+			});
+	return offsets[index];
+}
+
+template<typename Trait, typename Inputs>
+std::size_t decodeBatch(const Inputs &inputs, std::uint8_t *output
+		, std::size_t *offsets)
+{
+	using AlphabetType = typename Trait::AlphabetType;
+
+	const BaseCoder<Trait> coder;
+	std::size_t index = 0;
+	offsets[0] = 0;
+	for (const auto &input : inputs)
+	{
+		const AlphabetType *data = detail::batchData<AlphabetType>(input);
+		offsets[index + 1] = offsets[index]
+				+ coder.decodeSize(View(data, data + std::size(input)));
+		++index;
+	}
+
+	// inputs of whole blocks without pad decode to the same bytes when joined
+	detail::forEachRun<AlphabetType>(inputs
+			, [&offsets](std::size_t i, std::size_t size)
+			{
+				return size % Trait::indexBufferSize == 0
+						&& offsets[i + 1] - offsets[i]
+						== size / Trait::indexBufferSize * Trait::inputBufferSize;
+			}
+			, [&](std::size_t first, const AlphabetType *begin, const AlphabetType *end)
+			{
+				coder.decode(begin, end - begin, output + offsets[first]);
+			});
+	return offsets[index];
+}
+
+} // namespace base_coder
+
+#endif // BASECODER_BATCH_HPP
@@ -0,0 +1,103 @@
+#ifndef BASECODER_CPU_HPP
+#define BASECODER_CPU_HPP
+
+#include <atomic>
+
+#if !defined(BASECODER_NO_SIMD) && defined(__x86_64__) \
+		&& (defined(__GNUC__) || defined(__clang__))
+#define BASECODER_SIMD 1
+#define BASECODER_TARGET(features) __attribute__((target(features)))
+#else
+#define BASECODER_SIMD 0
+#define BASECODER_TARGET(features)
+#endif
+
+namespace base_coder
+{
+
+///
+/// \brief The SimdLevel enum
+///
+enum class SimdLevel
+{
+	Scalar, Ssse3, Avx2, Avx512, Avx512Vbmi
+};
+
+///
+/// \brief detectSimdLevel
+/// \return best instruction set supported by CPU and OS
+///
+inline SimdLevel detectSimdLevel()
+{
+#if BASECODER_SIMD
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+	{
+		return __builtin_cpu_supports("avx512vbmi")
+				? SimdLevel::Avx512Vbmi
+				: SimdLevel::Avx512;
+	}
+	if (__builtin_cpu_supports("avx2"))
+	{
+		return SimdLevel::Avx2;
+	}
+	if (__builtin_cpu_supports("ssse3"))
+	{
+		return SimdLevel::Ssse3;
+	}
+#endif
+	return SimdLevel::Scalar;
+}
+
+namespace detail
+{
+
+///
+/// \brief supportedSimdLevel
+/// \return level detected once at first call
+///
+inline SimdLevel supportedSimdLevel()
+{
+	static const SimdLevel level = detectSimdLevel();
+	return level;
+}
+
+///
+/// \brief activeSimdLevel
+/// \return level used by coders
+///
+inline std::atomic<SimdLevel> &activeSimdLevel()
+{
+	static std::atomic<SimdLevel> level{ supportedSimdLevel() };
+	return level;
+}
+
+} // namespace detail
+
+///
+/// \brief simdLevel
+/// \return instruction set used by coders
+///
+inline SimdLevel simdLevel()
+{
+	return detail::activeSimdLevel().load(std::memory_order_relaxed);
+}
+
+///
+/// \brief setSimdLevel
+/// \param level instruction set used by coders
+/// \return false if level isn't supported by CPU
+///
+inline bool setSimdLevel(SimdLevel level)
+{
+	if (level > detail::supportedSimdLevel())
+	{
+		return false;
+	}
+	detail::activeSimdLevel().store(level, std::memory_order_relaxed);
+	return true;
+}
+
+} // namespace base_coder
+
+#endif // BASECODER_CPU_HPP
@@ -0,0 +1,390 @@
+#ifndef BASECODER_DECODEDVIEW_HPP
+#define BASECODER_DECODEDVIEW_HPP
+
+#include <BaseCoder/BaseCoder.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+namespace base_coder
+{
+
+///
+/// \brief The DecodedView class: lazy random access to decoded bytes of encoded
+/// data, only blocks containing accessed bytes are decoded
+/// \tparam Trait
+/// \tparam Iterator random access iterator over encoded characters
+///
+template<typename Trait, typename Iterator>
+class DecodedView : private BaseCoder<Trait>
+{
+	using Coder = BaseCoder<Trait>;
+
+	static_assert(std::is_base_of_v<std::random_access_iterator_tag
+			, typename std::iterator_traits<Iterator>::iterator_category>
+			, "DecodedView needs random access iterator");
+
+public:
+	using Coder::inputBufferSize;
+	using Coder::indexBufferSize;
+
+	class ByteIterator;
+
+	///
+	/// \brief DecodedView
+	/// \param encoded
+	///
+	explicit DecodedView(View<Iterator> encoded);
+
+	///
+	/// \brief size
+	/// \return count of decoded bytes in view
+	///
+	std::size_t size() const;
+
+	///
+	/// \brief empty
+	/// \return
+	///
+	bool empty() const;
+
+	///
+	/// \brief operator []: decode block containing byte
+	/// \param index
+	/// \return decoded byte
+	///
+	std::uint8_t operator[](std::size_t index) const;
+
+	///
+	/// \brief at
+	/// \param index
+	/// \return decoded byte
+	/// \throw std::out_of_range
+	///
+	std::uint8_t at(std::size_t index) const;
+
+	///
+	/// \brief begin
+	/// \return
+	///
+	ByteIterator begin() const;
+
+	///
+	/// \brief end
+	/// \return
+	///
+	ByteIterator end() const;
+
+	///
+	/// \brief subview: view of decoded bytes [offset, offset + length), nothing
+	/// is decoded here
+	/// \param offset
+	/// \param length clamped to size() - offset
+	/// \return
+	/// \throw std::out_of_range if offset > size()
+	///
+	DecodedView subview(std::size_t offset
+			, std::size_t length = std::numeric_limits<std::size_t>::max()) const;
+
+	///
+	/// \brief decode: decode blocks of view only
+	/// \tparam OutputIterator
+	/// \param outputIterator
+	/// \return output iterator after written bytes
+	///
+	template<typename OutputIterator>
+	OutputIterator decode(OutputIterator outputIterator) const;
+
+private:
+	using typename Coder::AlphabetType;
+	using typename Coder::DecodeInput;
+	using typename Coder::DecodeOutput;
+
+	DecodedView(View<Iterator> encoded, std::size_t offset, std::size_t size);
+
+	///
+	/// \brief decodeBlock
+	/// \param block index of block from begin of encoded data
+	/// \return
+	///
+	DecodeOutput decodeBlock(std::size_t block) const;
+
+private:
+	View<Iterator> encoded; ///<
+	std::size_t encodedSize; ///< count of encoded characters
+	std::size_t offset; ///< first byte of view in decoded data
+	std::size_t viewSize; ///<
+};
+
+///
+/// \brief The DecodedView::ByteIterator class: random access iterator, keeps
+/// the last decoded block
+///
+template<typename Trait, typename Iterator>
+class DecodedView<Trait, Iterator>::ByteIterator
+{
+public:
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = std::uint8_t;
+	using difference_type = std::ptrdiff_t;
+	using pointer = void;
+	using reference = std::uint8_t;
+
+	ByteIterator() = default;
+
+	reference operator*() const
+	{
+		const std::size_t block = position / inputBufferSize;
+		if (block != cachedBlock)
+		{
+			cache = view->decodeBlock(block);
+			cachedBlock = block;
+		}
+		return cache[position % inputBufferSize];
+	}
+
+	reference operator[](difference_type n) const
+	{
+		return *(*this + n);
+	}
+
+	ByteIterator &operator++()
+	{
+		++position;
+		return *this;
+	}
+
+	ByteIterator operator++(int)
+	{
+		ByteIterator result = *this;
+		++position;
+		return result;
+	}
+
+	ByteIterator &operator--()
+	{
+		--position;
+		return *this;
+	}
+
+	ByteIterator operator--(int)
+	{
+		ByteIterator result = *this;
+		--position;
+		return result;
+	}
+
+	ByteIterator &operator+=(difference_type n)
+	{
+		position += n;
+		return *this;
+	}
+
+	ByteIterator &operator-=(difference_type n)
+	{
+		position -= n;
+		return *this;
+	}
+
+	friend ByteIterator operator+(ByteIterator it, difference_type n)
+	{
+		return it += n;
+	}
+
+	friend ByteIterator operator+(difference_type n, ByteIterator it)
+	{
+		return it += n;
+	}
+
+	friend ByteIterator operator-(ByteIterator it, difference_type n)
+	{
+		return it -= n;
+	}
+
+	friend difference_type operator-(const ByteIterator &a, const ByteIterator &b)
+	{
+		return static_cast<difference_type>(a.position - b.position);
+	}
+
+	friend bool operator==(const ByteIterator &a, const ByteIterator &b)
+	{
+		return a.position == b.position;
+	}
+
+	friend bool operator!=(const ByteIterator &a, const ByteIterator &b)
+	{
+		return a.position != b.position;
+	}
+
+	friend bool operator<(const ByteIterator &a, const ByteIterator &b)
+	{
+		return a.position < b.position;
+	}
+
+	friend bool operator>(const ByteIterator &a, const ByteIterator &b)
+	{
+		return a.position > b.position;
+	}
+
+	friend bool operator<=(const ByteIterator &a, const ByteIterator &b)
+	{
+		return a.position <= b.position;
+	}
+
+	friend bool operator>=(const ByteIterator &a, const ByteIterator &b)
+	{
+		return a.position >= b.position;
+	}
+
+private:
+	friend class DecodedView;
+
+	ByteIterator(const DecodedView *view, std::size_t position)
+			: view{ view }, position{ position }
+	{}
+
+private:
+	const DecodedView *view = nullptr; ///<
+	std::size_t position = 0; ///< index of byte in decoded data
+	mutable std::size_t cachedBlock = std::numeric_limits<std::size_t>::max(); ///<
+	mutable DecodeOutput cache{}; ///< bytes of cachedBlock
+};
+
+///
+/// \brief makeDecodedView
+/// \tparam Trait
+/// \tparam Container
+/// \param container encoded data, must outlive view
+/// \return
+///
+template<typename Trait, typename Container>
+auto makeDecodedView(const Container &container)
+{
+	return DecodedView<Trait, decltype(container.begin())>(makeConstView(container));
+}
+
+template<typename Trait, typename Iterator>
+DecodedView<Trait, Iterator>::DecodedView(View<Iterator> encoded)
+		: encoded{ encoded }
+		, encodedSize{ encoded.size() }
+		, offset{ 0 }
+		, viewSize{ this->decodeSize(encoded) }
+{}
+
+template<typename Trait, typename Iterator>
+DecodedView<Trait, Iterator>::DecodedView(View<Iterator> encoded, std::size_t offset
+		, std::size_t size)
+		: encoded{ encoded }
+		, encodedSize{ encoded.size() }
+		, offset{ offset }
+		, viewSize{ size }
+{}
+
+template<typename Trait, typename Iterator>
+std::size_t DecodedView<Trait, Iterator>::size() const
+{
+	return viewSize;
+}
+
+template<typename Trait, typename Iterator>
+bool DecodedView<Trait, Iterator>::empty() const
+{
+	return viewSize == 0;
+}
+
+template<typename Trait, typename Iterator>
+std::uint8_t DecodedView<Trait, Iterator>::operator[](std::size_t index) const
+{
+	const std::size_t position = offset + index;
+	return decodeBlock(position / inputBufferSize)[position % inputBufferSize];
+}
+
+template<typename Trait, typename Iterator>
+std::uint8_t DecodedView<Trait, Iterator>::at(std::size_t index) const
+{
+	if (index >= viewSize)
+	{
+		throw std::out_of_range("DecodedView index is out of range");
+	}
+	return (*this)[index];
+}
+
+template<typename Trait, typename Iterator>
+typename DecodedView<Trait, Iterator>::ByteIterator
+DecodedView<Trait, Iterator>::begin() const
+{
+	return ByteIterator(this, offset);
+}
+
+template<typename Trait, typename Iterator>
+typename DecodedView<Trait, Iterator>::ByteIterator
+DecodedView<Trait, Iterator>::end() const
+{
+	return ByteIterator(this, offset + viewSize);
+}
+
+template<typename Trait, typename Iterator>
+DecodedView<Trait, Iterator> DecodedView<Trait, Iterator>::subview(std::size_t offset
+		, std::size_t length) const
+{
+	if (offset > viewSize)
+	{
+		throw std::out_of_range("DecodedView offset is out of range");
+	}
+	return DecodedView(encoded, this->offset + offset
+			, std::min(length, viewSize - offset));
+}
+
+template<typename Trait, typename Iterator>
+template<typename OutputIterator>
+OutputIterator DecodedView<Trait, Iterator>::decode(OutputIterator outputIterator) const
+{
+	std::array<AlphabetType, indexBufferSize * Coder::stagingBlocks> input;
+	std::array<std::uint8_t, inputBufferSize * Coder::stagingBlocks> output;
+
+	const std::size_t last = offset + viewSize;
+	for (std::size_t position = offset; position != last; )
+	{
+		// staged blocks are padded after the end of encoded data
+		const std::size_t firstBlock = position / inputBufferSize;
+		const std::size_t blockCount = std::min(Coder::stagingBlocks
+				, (last - 1) / inputBufferSize - firstBlock + 1);
+		const std::size_t first = firstBlock * indexBufferSize;
+		const std::size_t count = std::min(blockCount * indexBufferSize, encodedSize - first);
+		std::copy_n(encoded.begin() + first, count, input.begin());
+		std::fill(input.begin() + count, input.begin() + blockCount * indexBufferSize
+				, Coder::pad);
+		this->decodeBlocks(input.data(), blockCount * indexBufferSize, output.data());
+
+		const std::size_t begin = position - firstBlock * inputBufferSize;
+		const std::size_t end = std::min(last - firstBlock * inputBufferSize
+				, blockCount * inputBufferSize);
+		outputIterator = std::copy(output.begin() + begin, output.begin() + end
+				, outputIterator);
+		position += end - begin;
+	}
+	return outputIterator;
+}
+
+template<typename Trait, typename Iterator>
+typename DecodedView<Trait, Iterator>::DecodeOutput
+DecodedView<Trait, Iterator>::decodeBlock(std::size_t block) const
+{
+	// characters after the end of encoded data are pad
+	DecodeInput decodeInput;
+	const std::size_t first = block * indexBufferSize;
+	for (std::size_t i = 0; i != indexBufferSize; ++i)
+	{
+		decodeInput[i] = static_cast<std::uint8_t>((first + i < encodedSize)
+				? encoded.begin()[first + i]
+				: Coder::pad);
+	}
+	return this->coreDecode(decodeInput);
+}
+
+} // namespace base_coder
+
+#endif // BASECODER_DECODEDVIEW_HPP
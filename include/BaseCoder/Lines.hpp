@@ -0,0 +1,365 @@
+#ifndef BASECODER_LINES_HPP
+#define BASECODER_LINES_HPP
+
+#include <BaseCoder/BaseCoder.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string_view>
+
+namespace base_coder
+{
+
+///
+/// \brief The LineOptions struct: line breaking of encoded data
+///
+struct LineOptions
+{
+	std::size_t length = 76; ///< count of characters in line, 0 disables breaking
+	std::string_view separator = "\r\n"; ///< inserted between lines, not after the last one
+};
+
+///
+/// \brief MIME (RFC 2045) lines
+///
+inline constexpr LineOptions mimeLines{ 76, "\r\n" };
+
+///
+/// \brief PEM (RFC 7468) lines
+///
+inline constexpr LineOptions pemLines{ 64, "\n" };
+
+///
+/// \brief The LineCoder class: encoding with line breaks and decoding skipping
+/// ASCII whitespace, both in one pass over input
+/// \tparam Trait
+///
+template<typename Trait>
+class LineCoder : private BaseCoder<Trait>
+{
+	using Coder = BaseCoder<Trait>;
+
+public:
+	using typename Coder::AlphabetType;
+
+	using Coder::inputBufferSize;
+	using Coder::indexBufferSize;
+
+	///
+	/// \brief LineCoder
+	/// \param options
+	///
+	explicit LineCoder(LineOptions options = mimeLines);
+
+	///
+	/// \brief encodeSize
+	/// \param size count of input bytes
+	/// \return count of encoded characters including separators
+	///
+	std::size_t encodeSize(std::size_t size) const;
+
+	///
+	/// \brief upperBoundDecodeSize
+	/// \param encodedSize count of encoded characters including whitespace
+	/// \return maximal count of decoded bytes, without looking at data
+	///
+	static constexpr std::size_t upperBoundDecodeSize(std::size_t encodedSize);
+
+	///
+	/// \brief encode: encoding with separator after every full line but the last
+	/// \param input
+	/// \param size count of input bytes
+	/// \param output buffer for encodeSize characters
+	/// \return count of written characters
+	///
+	std::size_t encode(const std::uint8_t *input, std::size_t size
+			, AlphabetType *output) const;
+
+	///
+	/// \brief decode: checked decoding, ASCII whitespace anywhere in input is skipped
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for upperBoundDecodeSize bytes
+	/// \return status, offset of the first bad character in input and count
+	/// of written bytes
+	///
+	DecodeResult decode(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output) const;
+
+#if defined(__cpp_lib_span)
+	///
+	/// \brief encode: encoding with separator after every full line but the last
+	/// \param input
+	/// \param output buffer for encodeSize characters
+	/// \return count of written characters
+	///
+	std::size_t encode(std::span<const std::byte> input
+			, std::span<AlphabetType> output) const;
+
+	///
+	/// \brief decode: checked decoding, ASCII whitespace anywhere in input is skipped
+	/// \param input
+	/// \param output buffer for upperBoundDecodeSize bytes
+	/// \return status, offset of the first bad character in input and count
+	/// of written bytes
+	///
+	DecodeResult decode(std::span<const AlphabetType> input
+			, std::span<std::byte> output) const;
+#endif
+
+private:
+	///
+	/// \brief Count of characters encoded to buffer or compacted and decoded at once
+	///
+	static constexpr std::size_t chunkSize = std::size_t{ 16 } << 10;
+
+	static_assert(chunkSize % indexBufferSize == 0, "Chunk must be whole blocks");
+
+	///
+	/// \brief writeLines: copy encoded characters breaking lines
+	/// \param input
+	/// \param size count of input characters
+	/// \param output
+	/// \param column count of characters in current line, updated
+	/// \return count of written characters
+	///
+	std::size_t writeLines(const AlphabetType *input, std::size_t size
+			, AlphabetType *output, std::size_t &column) const;
+
+	///
+	/// \brief writeSeparator
+	/// \param output
+	/// \return count of written characters
+	///
+	std::size_t writeSeparator(AlphabetType *output) const;
+
+	///
+	/// \brief stripWhitespace
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for size characters
+	/// \return count of kept characters
+	///
+	static std::size_t stripWhitespace(const AlphabetType *input, std::size_t size
+			, AlphabetType *output);
+
+	///
+	/// \brief inputOffset
+	/// \param input
+	/// \param size count of input characters
+	/// \param index index of character in input without whitespace
+	/// \return offset of the character in input, size if there is none
+	///
+	static std::size_t inputOffset(const AlphabetType *input, std::size_t size
+			, std::size_t index);
+
+	static constexpr bool isWhitespace(AlphabetType character);
+
+private:
+	LineOptions options; ///<
+};
+
+template<typename Trait>
+LineCoder<Trait>::LineCoder(LineOptions options)
+		: options{ options }
+{}
+
+template<typename Trait>
+std::size_t LineCoder<Trait>::encodeSize(std::size_t size) const
+{
+	const std::size_t encoded = Coder::encodedSize(size);
+	const std::size_t breaks = (options.length && encoded)
+			? (encoded - 1) / options.length
+			: 0;
+	return encoded + breaks * options.separator.size();
+}
+
+template<typename Trait>
+constexpr std::size_t LineCoder<Trait>::upperBoundDecodeSize(std::size_t encodedSize)
+{
+	return Coder::upperBoundDecodeSize(encodedSize);
+}
+
+template<typename Trait>
+std::size_t LineCoder<Trait>::encode(const std::uint8_t *input, std::size_t size
+		, AlphabetType *output) const
+{
+	if (options.length == 0)
+	{
+		return Coder::encode(input, size, output);
+	}
+
+	// chunks are encoded by kernels to buffer in cache and copied line by line
+	std::array<AlphabetType, chunkSize> buffer;
+	std::size_t written = 0;
+	constexpr std::size_t chunkBytes = chunkSize / indexBufferSize * inputBufferSize;
+	std::size_t column = 0;
+	for (std::size_t position = 0; position != size; )
+	{
+		const std::size_t count = std::min(chunkBytes, size - position);
+		const std::size_t encoded = (count == chunkBytes)
+				? this->encodeBlocks(input + position, count, buffer.data())
+				: Coder::encode(input + position, count, buffer.data());
+		written += writeLines(buffer.data(), encoded, output + written, column);
+		position += count;
+	}
+	return written;
+}
+
+template<typename Trait>
+DecodeResult LineCoder<Trait>::decode(const AlphabetType *input, std::size_t size
+		, std::uint8_t *output) const
+{
+	// the last block is kept in staging until something follows it, only the
+	// last block of data may have pad
+	std::array<AlphabetType, chunkSize + indexBufferSize> staging;
+	std::size_t pending = 0;
+	std::size_t stripped = 0; // count of characters without whitespace before staging
+	DecodeResult result;
+	for (std::size_t position = 0; ; )
+	{
+		const std::size_t count = std::min(chunkSize, size - position);
+		const std::size_t total = pending + stripWhitespace(input + position, count
+				, staging.data() + pending);
+		position += count;
+
+		const bool last = (position == size);
+		const std::size_t part = (last || total == 0)
+				? total
+				: (total - 1) / indexBufferSize * indexBufferSize;
+		DecodeResult partResult = Coder::decodeChecked(staging.data(), part
+				, output + result.written);
+		result.written += partResult.written;
+		if (partResult && !last
+				&& partResult.written != part / indexBufferSize * inputBufferSize)
+		{
+			partResult.status = DecodeStatus::InvalidPadding;
+			partResult.errorOffset = static_cast<std::size_t>(std::find(staging.data()
+					, staging.data() + part, Coder::pad) - staging.data());
+		}
+
+		if (!partResult)
+		{
+			result.status = partResult.status;
+			result.errorOffset = (partResult.status == DecodeStatus::InvalidLength)
+					? size
+					: inputOffset(input, size, stripped + partResult.errorOffset);
+			return result;
+		}
+		if (last)
+		{
+			result.errorOffset = size;
+			return result;
+		}
+
+		std::copy(staging.begin() + part, staging.begin() + total, staging.begin());
+		pending = total - part;
+		stripped += part;
+	}
+}
+
+#if defined(__cpp_lib_span)
+template<typename Trait>
+std::size_t LineCoder<Trait>::encode(std::span<const std::byte> input
+		, std::span<AlphabetType> output) const
+{
+	return encode(reinterpret_cast<const std::uint8_t *>(input.data()), input.size()
+			, output.data());
+}
+
+template<typename Trait>
+DecodeResult LineCoder<Trait>::decode(std::span<const AlphabetType> input
+		, std::span<std::byte> output) const
+{
+	return decode(input.data(), input.size()
+			, reinterpret_cast<std::uint8_t *>(output.data()));
+}
+#endif
+
+template<typename Trait>
+std::size_t LineCoder<Trait>::writeLines(const AlphabetType *input, std::size_t size
+		, AlphabetType *output, std::size_t &column) const
+{
+	std::size_t written = 0;
+	for (std::size_t position = 0; position != size; )
+	{
+		if (column == options.length)
+		{
+			written += writeSeparator(output + written);
+			column = 0;
+		}
+		const std::size_t count = std::min(options.length - column, size - position);
+		std::copy_n(input + position, count, output + written);
+		position += count;
+		written += count;
+		column += count;
+	}
+	return written;
+}
+
+template<typename Trait>
+std::size_t LineCoder<Trait>::writeSeparator(AlphabetType *output) const
+{
+	std::copy(options.separator.begin(), options.separator.end(), output);
+	return options.separator.size();
+}
+
+template<typename Trait>
+std::size_t LineCoder<Trait>::stripWhitespace(const AlphabetType *input, std::size_t size
+		, AlphabetType *output)
+{
+	std::size_t written = 0;
+	std::size_t position = simd::stripWhitespace(simdLevel(), input, size, output, written);
+	for (; size - position >= sizeof(swar::detail::Word); position += sizeof(swar::detail::Word))
+	{
+		// words without characters below '!' are copied at once
+		swar::detail::Word word;
+		std::memcpy(&word, input + position, sizeof(word));
+		constexpr swar::detail::Word ones = ~swar::detail::Word{ 0 } / 0xFF;
+		if (((word - ones * '!') & ~word & (ones * 0x80)) == 0)
+		{
+			std::memcpy(output + written, &word, sizeof(word));
+			written += sizeof(word);
+			continue;
+		}
+		for (std::size_t i = position; i != position + sizeof(word); ++i)
+		{
+			output[written] = input[i];
+			written += !isWhitespace(input[i]);
+		}
+	}
+	for (; position != size; ++position)
+	{
+		// branchless: whitespace is overwritten by the next character
+		output[written] = input[position];
+		written += !isWhitespace(input[position]);
+	}
+	return written;
+}
+
+template<typename Trait>
+std::size_t LineCoder<Trait>::inputOffset(const AlphabetType *input, std::size_t size
+		, std::size_t index)
+{
+	for (std::size_t position = 0; position != size; ++position)
+	{
+		if (!isWhitespace(input[position]) && index-- == 0)
+		{
+			return position;
+		}
+	}
+	return size;
+}
+
+template<typename Trait>
+constexpr bool LineCoder<Trait>::isWhitespace(AlphabetType character)
+{
+	// ' ' or one of '\t', '\n', '\v', '\f', '\r'
+	return character == ' '
+			|| static_cast<std::uint8_t>(static_cast<std::uint8_t>(character) - '\t') <= 4;
+}
+
+} // namespace base_coder
+
+#endif // BASECODER_LINES_HPP
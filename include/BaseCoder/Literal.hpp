@@ -0,0 +1,226 @@
+#ifndef BASECODER_LITERAL_HPP
+#define BASECODER_LITERAL_HPP
+
+#include <BaseCoder/BaseCoder.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace base_coder
+{
+
+namespace detail
+{
+
+///
+/// \brief The LiteralCoder class: core coding usable in constant expressions
+/// \tparam Coder BaseCoder specialization
+///
+template<typename Coder>
+class LiteralCoder : public Coder
+{
+public:
+	using typename Coder::EncodeInput;
+	using typename Coder::DecodeInput;
+
+	using Coder::coreEncode;
+	using Coder::coreDecode;
+	using Coder::encodedSize;
+};
+
+} // namespace detail
+
+///
+/// \brief The DecodedLiteral class: bytes decoded at compile time
+/// \tparam CAPACITY upper bound of decoded size, the real size depends on pad
+///
+template<std::size_t CAPACITY>
+class DecodedLiteral
+{
+public:
+	constexpr const std::uint8_t *data() const
+	{
+		return bytes.data();
+	}
+
+	constexpr std::size_t size() const
+	{
+		return length;
+	}
+
+	constexpr const std::uint8_t *begin() const
+	{
+		return bytes.data();
+	}
+
+	constexpr const std::uint8_t *end() const
+	{
+		return bytes.data() + length;
+	}
+
+	constexpr std::uint8_t operator[](std::size_t index) const
+	{
+		return bytes[index];
+	}
+
+private:
+	template<typename Coder, std::size_t SIZE>
+	friend constexpr DecodedLiteral<Coder::upperBoundDecodeSize(SIZE - 1)>
+	decodeLiteral(const typename Coder::AlphabetType (&literal)[SIZE]);
+
+private:
+	std::array<std::uint8_t, CAPACITY> bytes{}; ///<
+	std::size_t length = 0; ///<
+};
+
+///
+/// \brief encodeLiteral: compile-time encoding
+/// \tparam Coder
+/// \tparam SIZE
+/// \param input
+/// \return encoded characters without terminating null
+///
+template<typename Coder, std::size_t SIZE>
+constexpr std::array<typename Coder::AlphabetType
+		, detail::LiteralCoder<Coder>::encodedSize(SIZE)>
+encodeLiteral(const std::array<std::uint8_t, SIZE> &input)
+{
+	using LiteralCoder = detail::LiteralCoder<Coder>;
+
+	const LiteralCoder coder{};
+	std::array<typename Coder::AlphabetType, LiteralCoder::encodedSize(SIZE)> output{};
+	std::size_t written = 0;
+	for (std::size_t position = 0; position < SIZE; position += Coder::inputBufferSize)
+	{
+		const std::size_t count = (SIZE - position < Coder::inputBufferSize)
+				? SIZE - position
+				: Coder::inputBufferSize;
+		typename LiteralCoder::EncodeInput block{};
+		for (std::size_t i = 0; i != count; ++i)
+		{
+			block[i] = input[position + i];
+		}
+
+		const auto characters = coder.coreEncode(block, count);
+		const std::size_t characterCount = (Coder::padding == Padding::Forbidden)
+				? (count * CHAR_BIT + Coder::indexBitSize - 1) / Coder::indexBitSize
+				: Coder::indexBufferSize;
+		for (std::size_t i = 0; i != characterCount; ++i)
+		{
+			output[written++] = static_cast<typename Coder::AlphabetType>(characters[i]);
+		}
+	}
+	return output;
+}
+
+///
+/// \brief encodeLiteral: compile-time encoding of string literal
+/// \tparam Coder
+/// \tparam SIZE
+/// \param literal
+/// \return encoded characters of literal without terminating null
+///
+template<typename Coder, std::size_t SIZE>
+constexpr auto encodeLiteral(const char (&literal)[SIZE])
+{
+	std::array<std::uint8_t, SIZE - 1> input{};
+	for (std::size_t i = 0; i != input.size(); ++i)
+	{
+		input[i] = static_cast<std::uint8_t>(literal[i]);
+	}
+	return encodeLiteral<Coder>(input);
+}
+
+///
+/// \brief decodeLiteral: compile-time decoding, invalid literal isn't
+/// a constant expression
+/// \tparam Coder
+/// \tparam SIZE
+/// \param literal
+/// \return decoded bytes
+/// \throw std::invalid_argument if called at run time with invalid literal
+///
+template<typename Coder, std::size_t SIZE>
+constexpr DecodedLiteral<Coder::upperBoundDecodeSize(SIZE - 1)>
+decodeLiteral(const typename Coder::AlphabetType (&literal)[SIZE])
+{
+	using LiteralCoder = detail::LiteralCoder<Coder>;
+
+	constexpr std::size_t length = SIZE - 1;
+	std::size_t dataSize = length;
+	while (dataSize && literal[dataSize - 1] == Coder::pad)
+	{
+		--dataSize;
+	}
+	for (std::size_t i = 0; i != dataSize; ++i)
+	{
+		if (Coder::reverseAlphabet[static_cast<std::uint8_t>(literal[i])] >= Coder::alphabetSize)
+		{
+			throw std::invalid_argument("decodeLiteral: invalid character");
+		}
+	}
+
+	// the same rules as in decodeChecked
+	const std::size_t padSize = length - dataSize;
+	const std::size_t tailSize = dataSize % Coder::indexBufferSize;
+	const std::size_t tailBytes = tailSize * Coder::indexBitSize / CHAR_BIT;
+	if (tailSize != (tailBytes * CHAR_BIT + Coder::indexBitSize - 1) / Coder::indexBitSize)
+	{
+		throw std::invalid_argument("decodeLiteral: invalid length");
+	}
+	if ((padSize && (tailSize == 0 || padSize != Coder::indexBufferSize - tailSize
+			|| Coder::padding == Padding::Forbidden))
+			|| (Coder::padding == Padding::Required && tailSize && padSize == 0))
+	{
+		throw std::invalid_argument("decodeLiteral: invalid padding");
+	}
+
+	const LiteralCoder coder{};
+	DecodedLiteral<Coder::upperBoundDecodeSize(length)> result{};
+	for (std::size_t position = 0; position < dataSize; position += Coder::indexBufferSize)
+	{
+		typename LiteralCoder::DecodeInput block{};
+		for (std::size_t i = 0; i != Coder::indexBufferSize; ++i)
+		{
+			block[i] = static_cast<std::uint8_t>((position + i < dataSize)
+					? literal[position + i]
+					: Coder::pad);
+		}
+
+		const auto bytes = coder.coreDecode(block);
+		const std::size_t count = (dataSize - position < Coder::indexBufferSize)
+				? tailBytes
+				: Coder::inputBufferSize;
+		for (std::size_t i = 0; i != count; ++i)
+		{
+			result.bytes[result.length++] = bytes[i];
+		}
+	}
+	return result;
+}
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+///
+/// \brief decodeLiteral: compile-time decoding to array of exact size
+/// \tparam Coder
+/// \tparam LITERAL
+/// \return decoded bytes
+///
+template<typename Coder, FixedString LITERAL>
+constexpr auto decodeLiteral()
+{
+	constexpr auto decoded = decodeLiteral<Coder>(LITERAL.value);
+	std::array<std::uint8_t, decoded.size()> result{};
+	for (std::size_t i = 0; i != result.size(); ++i)
+	{
+		result[i] = decoded[i];
+	}
+	return result;
+}
+#endif
+
+} // namespace base_coder
+
+#endif // BASECODER_LITERAL_HPP
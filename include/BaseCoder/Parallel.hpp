@@ -0,0 +1,241 @@
+#ifndef BASECODER_PARALLEL_HPP
+#define BASECODER_PARALLEL_HPP
+
+#include <BaseCoder/BaseCoder.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace base_coder
+{
+
+///
+/// \brief The ParallelOptions struct
+///
+struct ParallelOptions
+{
+	std::size_t threadCount = std::thread::hardware_concurrency(); ///< 0 means 1
+	std::size_t minimalSize = std::size_t{ 1 } << 20; ///< smaller inputs use calling thread
+	std::size_t minimalPartSize = std::size_t{ 256 } << 10; ///< least input per thread
+};
+
+///
+/// \brief parallelEncode
+/// \tparam Trait
+/// \param input
+/// \param size count of input bytes
+/// \param output buffer for encodeSize characters
+/// \param options
+/// \return count of written characters
+///
+template<typename Trait>
+std::size_t parallelEncode(const std::uint8_t *input, std::size_t size
+		, typename Trait::AlphabetType *output, const ParallelOptions &options = {});
+
+///
+/// \brief parallelDecode
+/// \tparam Trait
+/// \param input
+/// \param size count of input characters
+/// \param output buffer for decodeSize bytes
+/// \param options
+/// \return count of written bytes
+///
+template<typename Trait>
+std::size_t parallelDecode(const typename Trait::AlphabetType *input, std::size_t size
+		, std::uint8_t *output, const ParallelOptions &options = {});
+
+namespace detail
+{
+
+///
+/// \brief The ThreadPool class: workers are started on first use and live until exit,
+/// so repeated calls on chunks of a stream don't pay for thread creation
+///
+class ThreadPool
+{
+public:
+	///
+	/// \brief instance
+	/// \return pool shared by all parallel calls
+	///
+	static ThreadPool &instance()
+	{
+		static ThreadPool pool;
+		return pool;
+	}
+
+	ThreadPool(const ThreadPool &) = delete;
+	ThreadPool &operator=(const ThreadPool &) = delete;
+
+	~ThreadPool()
+	{
+		{
+			const std::lock_guard<std::mutex> lock(mutex);
+			stopped = true;
+		}
+		ready.notify_all();
+		for (auto &thread : threads)
+		{
+			thread.join();
+		}
+	}
+
+	///
+	/// \brief run: call task(index) for every index below count, index 0 in calling
+	/// thread, and wait for all of them
+	/// \param count at least 1
+	/// \param task
+	///
+	template<typename Task>
+	void run(std::size_t count, const Task &task)
+	{
+		std::size_t remaining = count - 1;
+		std::condition_variable done;
+		{
+			const std::lock_guard<std::mutex> lock(mutex);
+			while (threads.size() < count - 1)
+			{
+				threads.emplace_back([this]() { work(); });
+			}
+			for (std::size_t index = 1; index < count; ++index)
+			{
+				tasks.emplace_back([this, &task, &remaining, &done, index]()
+				{
+					task(index);
+					// notified under lock, the waiting caller owns done
+					const std::lock_guard<std::mutex> lock(mutex);
+					if (--remaining == 0)
+					{
+						done.notify_one();
+					}
+				});
+			}
+		}
+		ready.notify_all();
+
+		task(std::size_t{ 0 });
+		std::unique_lock<std::mutex> lock(mutex);
+		done.wait(lock, [&remaining]() { return remaining == 0; });
+	}
+
+private:
+	ThreadPool() = default;
+
+	void work()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		for (;;)
+		{
+			ready.wait(lock, [this]() { return stopped || !tasks.empty(); });
+			if (tasks.empty())
+			{
+				return;
+			}
+			const std::function<void()> task = std::move(tasks.front());
+			tasks.pop_front();
+			lock.unlock();
+			task();
+			lock.lock();
+		}
+	}
+
+private:
+	std::mutex mutex; ///<
+	std::condition_variable ready; ///< tasks are queued or pool is stopped
+	std::deque<std::function<void()>> tasks; ///<
+	std::vector<std::thread> threads; ///<
+	bool stopped = false; ///<
+};
+
+///
+/// \brief partSize
+/// \param size count of input elements
+/// \param blockSize count of input elements in block
+/// \param options
+/// \return count of input elements processed by one thread, multiple of blockSize
+///
+inline std::size_t partSize(std::size_t size, std::size_t blockSize
+		, const ParallelOptions &options)
+{
+	const std::size_t threadCount = std::max<std::size_t>(options.threadCount, 1);
+	if (size < options.minimalSize || threadCount == 1)
+	{
+		return size;
+	}
+	std::size_t part = std::max(size / threadCount + 1, options.minimalPartSize);
+	part += (blockSize - part % blockSize) % blockSize;
+	return part;
+}
+
+///
+/// \brief runParts: call callable(begin, end) for parts of input in shared pool, the
+/// first part is processed by calling thread
+///
+template<typename Callable>
+void runParts(std::size_t size, std::size_t part, Callable &&callable)
+{
+	const std::size_t count = (size + part - 1) / part;
+	ThreadPool::instance().run(count, [&callable, size, part](std::size_t index)
+	{
+		const std::size_t begin = index * part;
+		callable(begin, std::min(size, begin + part));
+	});
+}
+
+} // namespace detail
+
+template<typename Trait>
+std::size_t parallelEncode(const std::uint8_t *input, std::size_t size
+		, typename Trait::AlphabetType *output, const ParallelOptions &options)
+{
+	const BaseCoder<Trait> coder;
+	const std::size_t part = detail::partSize(size, Trait::inputBufferSize, options);
+	if (part >= size)
+	{
+		return coder.encode(input, size, output);
+	}
+
+	// parts are block aligned, so output offsets are known in advance
+	detail::runParts(size, part, [&](std::size_t begin, std::size_t end)
+	{
+		coder.encode(input + begin, end - begin
+				, output + begin / Trait::inputBufferSize * Trait::indexBufferSize);
+	});
+	return coder.encodeSize(View(input, input + size));
+}
+
+template<typename Trait>
+std::size_t parallelDecode(const typename Trait::AlphabetType *input, std::size_t size
+		, std::uint8_t *output, const ParallelOptions &options)
+{
+	const BaseCoder<Trait> coder;
+	const std::size_t part = detail::partSize(size, Trait::indexBufferSize, options);
+	if (part >= size)
+	{
+		return coder.decode(input, size, output);
+	}
+
+	// only the last part may contain pad
+	std::size_t lastWritten = 0;
+	const std::size_t lastBegin = (size - 1) / part * part;
+	detail::runParts(size, part, [&](std::size_t begin, std::size_t end)
+	{
+		const std::size_t written = coder.decode(input + begin, end - begin
+				, output + begin / Trait::indexBufferSize * Trait::inputBufferSize);
+		if (begin == lastBegin)
+		{
+			lastWritten = written;
+		}
+	});
+	return lastBegin / Trait::indexBufferSize * Trait::inputBufferSize + lastWritten;
+}
+
+} // namespace base_coder
+
+#endif // BASECODER_PARALLEL_HPP
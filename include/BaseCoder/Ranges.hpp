@@ -0,0 +1,510 @@
+#ifndef BASECODER_RANGES_HPP
+#define BASECODER_RANGES_HPP
+
+#include <BaseCoder/BaseCoder.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if __cplusplus >= 202002L && __has_include(<ranges>)
+#include <ranges>
+#endif
+
+#if defined(__cpp_lib_ranges)
+
+namespace base_coder
+{
+
+namespace detail
+{
+
+///
+/// \brief The CoderTrait struct: Trait of BaseCoder
+/// \tparam Coder
+///
+template<typename Coder>
+struct CoderTrait;
+
+template<typename Trait>
+struct CoderTrait<BaseCoder<Trait>>
+{
+	using Type = Trait;
+};
+
+///
+/// \brief ByteRange: input range of one byte elements, like iterators
+/// accepted by BaseCoder::checkIteratorType
+///
+template<typename Range>
+concept ByteRange = std::ranges::input_range<Range>
+		&& sizeof(std::ranges::range_value_t<Range>) == 1;
+
+///
+/// \brief Count of blocks buffered by iterators of range views
+///
+constexpr std::size_t rangeBlocks = 64;
+
+} // namespace detail
+
+///
+/// \brief The EncodingView class: lazy encoding of range of bytes, characters
+/// are produced by blocks while view is iterated
+/// \tparam Trait
+/// \tparam Range view of bytes
+///
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+class EncodingView : public std::ranges::view_interface<EncodingView<Trait, Range>>
+		, private BaseCoder<Trait>
+{
+	using Coder = BaseCoder<Trait>;
+
+public:
+	using typename Coder::AlphabetType;
+
+	using Coder::inputBufferSize;
+	using Coder::indexBufferSize;
+
+	class Iterator;
+
+	EncodingView() requires std::default_initializable<Range> = default;
+
+	///
+	/// \brief EncodingView
+	/// \param base
+	///
+	constexpr explicit EncodingView(Range base);
+
+	///
+	/// \brief base
+	/// \return view of bytes
+	///
+	constexpr Range base() const;
+
+	///
+	/// \brief begin: the first block is encoded here
+	/// \return
+	///
+	Iterator begin();
+
+	///
+	/// \brief end
+	/// \return
+	///
+	constexpr std::default_sentinel_t end() const;
+
+	///
+	/// \brief size
+	/// \return count of encoded characters
+	///
+	constexpr std::size_t size() const requires std::ranges::sized_range<const Range>;
+
+private:
+	Range encoded; ///< bytes to encode
+};
+
+///
+/// \brief The EncodingView::Iterator class: input iterator over characters of
+/// encoded blocks
+///
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+class EncodingView<Trait, Range>::Iterator
+{
+public:
+	using iterator_concept = std::input_iterator_tag;
+	using value_type = AlphabetType;
+	using difference_type = std::ptrdiff_t;
+
+	Iterator() = default;
+
+	value_type operator*() const
+	{
+		return buffer[position];
+	}
+
+	Iterator &operator++()
+	{
+		if (++position == bufferSize)
+		{
+			fill();
+		}
+		return *this;
+	}
+
+	void operator++(int)
+	{
+		++*this;
+	}
+
+	friend bool operator==(const Iterator &it, std::default_sentinel_t)
+	{
+		return it.position == it.bufferSize;
+	}
+
+private:
+	friend class EncodingView;
+
+	Iterator(EncodingView *view)
+			: view{ view }
+			, current{ std::ranges::begin(view->encoded) }
+	{
+		fill();
+	}
+
+	///
+	/// \brief fill: encode the next blocks, the tail with the last bytes
+	///
+	void fill();
+
+private:
+	EncodingView *view = nullptr; ///<
+	std::ranges::iterator_t<Range> current{}; ///< the first byte of the next blocks
+	std::array<AlphabetType, indexBufferSize * detail::rangeBlocks> buffer; ///<
+	std::size_t bufferSize = 0; ///< count of encoded characters in buffer
+	std::size_t position = 0; ///< index of current character in buffer
+};
+
+///
+/// \brief The DecodingView class: lazy decoding of range of characters, bytes
+/// are produced by blocks while view is iterated. Input isn't checked, as by
+/// BaseCoder::decode
+/// \tparam Trait
+/// \tparam Range view of characters
+///
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+class DecodingView : public std::ranges::view_interface<DecodingView<Trait, Range>>
+		, private BaseCoder<Trait>
+{
+	using Coder = BaseCoder<Trait>;
+
+public:
+	using typename Coder::AlphabetType;
+
+	using Coder::inputBufferSize;
+	using Coder::indexBufferSize;
+
+	class Iterator;
+
+	DecodingView() requires std::default_initializable<Range> = default;
+
+	///
+	/// \brief DecodingView
+	/// \param base
+	///
+	constexpr explicit DecodingView(Range base);
+
+	///
+	/// \brief base
+	/// \return view of characters
+	///
+	constexpr Range base() const;
+
+	///
+	/// \brief begin: the first block is decoded here
+	/// \return
+	///
+	Iterator begin();
+
+	///
+	/// \brief end
+	/// \return
+	///
+	constexpr std::default_sentinel_t end() const;
+
+	///
+	/// \brief size: trailing pad is looked for in random access range
+	/// \return count of decoded bytes
+	///
+	std::size_t size() const requires std::ranges::sized_range<const Range>
+			&& std::ranges::random_access_range<const Range>;
+
+private:
+	Range decoded; ///< characters to decode
+};
+
+///
+/// \brief The DecodingView::Iterator class: input iterator over bytes of decoded
+/// blocks
+///
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+class DecodingView<Trait, Range>::Iterator
+{
+public:
+	using iterator_concept = std::input_iterator_tag;
+	using value_type = std::uint8_t;
+	using difference_type = std::ptrdiff_t;
+
+	Iterator() = default;
+
+	value_type operator*() const
+	{
+		return buffer[position];
+	}
+
+	Iterator &operator++()
+	{
+		if (++position == bufferSize)
+		{
+			fill();
+		}
+		return *this;
+	}
+
+	void operator++(int)
+	{
+		++*this;
+	}
+
+	friend bool operator==(const Iterator &it, std::default_sentinel_t)
+	{
+		return it.position == it.bufferSize;
+	}
+
+private:
+	friend class DecodingView;
+
+	Iterator(DecodingView *view)
+			: view{ view }
+			, current{ std::ranges::begin(view->decoded) }
+	{
+		fill();
+	}
+
+	///
+	/// \brief fill: decode the next blocks, the last one may be padded or
+	/// incomplete
+	///
+	void fill();
+
+private:
+	DecodingView *view = nullptr; ///<
+	std::ranges::iterator_t<Range> current{}; ///< the first character of the next blocks
+	std::array<std::uint8_t, inputBufferSize * detail::rangeBlocks> buffer; ///<
+	std::size_t bufferSize = 0; ///< count of decoded bytes in buffer
+	std::size_t position = 0; ///< index of current byte in buffer
+};
+
+namespace detail
+{
+
+///
+/// \brief The EncodeAdaptor struct: range adaptor closure of EncodingView
+/// \tparam Trait
+///
+template<typename Trait>
+struct EncodeAdaptor
+{
+	template<std::ranges::viewable_range Range>
+			requires ByteRange<std::views::all_t<Range>>
+	constexpr auto operator()(Range &&range) const
+	{
+		return EncodingView<Trait, std::views::all_t<Range>>(
+				std::views::all(std::forward<Range>(range)));
+	}
+
+	template<std::ranges::viewable_range Range>
+			requires ByteRange<std::views::all_t<Range>>
+	friend constexpr auto operator|(Range &&range, const EncodeAdaptor &adaptor)
+	{
+		return adaptor(std::forward<Range>(range));
+	}
+};
+
+///
+/// \brief The DecodeAdaptor struct: range adaptor closure of DecodingView
+/// \tparam Trait
+///
+template<typename Trait>
+struct DecodeAdaptor
+{
+	template<std::ranges::viewable_range Range>
+			requires ByteRange<std::views::all_t<Range>>
+	constexpr auto operator()(Range &&range) const
+	{
+		return DecodingView<Trait, std::views::all_t<Range>>(
+				std::views::all(std::forward<Range>(range)));
+	}
+
+	template<std::ranges::viewable_range Range>
+			requires ByteRange<std::views::all_t<Range>>
+	friend constexpr auto operator|(Range &&range, const DecodeAdaptor &adaptor)
+	{
+		return adaptor(std::forward<Range>(range));
+	}
+};
+
+} // namespace detail
+
+namespace views
+{
+
+///
+/// \brief encode: data | views::encode<Base64> is input range of characters
+/// \tparam Coder
+///
+template<typename Coder>
+inline constexpr detail::EncodeAdaptor<typename detail::CoderTrait<Coder>::Type> encode{};
+
+///
+/// \brief decode: encoded | views::decode<Base64> is input range of bytes
+/// \tparam Coder
+///
+template<typename Coder>
+inline constexpr detail::DecodeAdaptor<typename detail::CoderTrait<Coder>::Type> decode{};
+
+} // namespace views
+
+// EncodingView
+
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+constexpr EncodingView<Trait, Range>::EncodingView(Range base)
+		: encoded{ std::move(base) }
+{}
+
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+constexpr Range EncodingView<Trait, Range>::base() const
+{
+	return encoded;
+}
+
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+typename EncodingView<Trait, Range>::Iterator EncodingView<Trait, Range>::begin()
+{
+	return Iterator(this);
+}
+
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+constexpr std::default_sentinel_t EncodingView<Trait, Range>::end() const
+{
+	return std::default_sentinel;
+}
+
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+constexpr std::size_t EncodingView<Trait, Range>::size() const
+		requires std::ranges::sized_range<const Range>
+{
+	return Coder::encodedSize(static_cast<std::size_t>(std::ranges::size(encoded)));
+}
+
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+void EncodingView<Trait, Range>::Iterator::fill()
+{
+	constexpr std::size_t chunkSize = inputBufferSize * detail::rangeBlocks;
+	const auto last = std::ranges::end(view->encoded);
+	position = 0;
+
+	const std::uint8_t *input;
+	std::size_t size;
+	std::array<std::uint8_t, chunkSize> staging;
+	if constexpr (std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>)
+	{
+		// bytes are encoded in place
+		size = std::min(chunkSize, static_cast<std::size_t>(last - current));
+		input = reinterpret_cast<const std::uint8_t *>(std::to_address(current));
+		current += static_cast<difference_type>(size);
+	}
+	else
+	{
+		size = 0;
+		for (; size != chunkSize && current != last; ++current)
+		{
+			staging[size++] = static_cast<std::uint8_t>(*current);
+		}
+		input = staging.data();
+	}
+
+	// the tail and pad only at the end of data
+	bufferSize = (current == last)
+			? view->encode(input, size, buffer.data())
+			: view->encodeBlocks(input, size, buffer.data());
+}
+
+// DecodingView
+
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+constexpr DecodingView<Trait, Range>::DecodingView(Range base)
+		: decoded{ std::move(base) }
+{}
+
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+constexpr Range DecodingView<Trait, Range>::base() const
+{
+	return decoded;
+}
+
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+typename DecodingView<Trait, Range>::Iterator DecodingView<Trait, Range>::begin()
+{
+	return Iterator(this);
+}
+
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+constexpr std::default_sentinel_t DecodingView<Trait, Range>::end() const
+{
+	return std::default_sentinel;
+}
+
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+std::size_t DecodingView<Trait, Range>::size() const
+		requires std::ranges::sized_range<const Range>
+				&& std::ranges::random_access_range<const Range>
+{
+	const auto first = std::ranges::begin(decoded);
+	return this->decodeSize(View(first
+			, first + static_cast<std::ptrdiff_t>(std::ranges::size(decoded))));
+}
+
+template<typename Trait, std::ranges::view Range>
+		requires detail::ByteRange<Range>
+void DecodingView<Trait, Range>::Iterator::fill()
+{
+	constexpr std::size_t chunkSize = indexBufferSize * detail::rangeBlocks;
+	const auto last = std::ranges::end(view->decoded);
+	position = 0;
+
+	const AlphabetType *input;
+	std::size_t size;
+	std::array<AlphabetType, chunkSize> staging;
+	if constexpr (std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>)
+	{
+		size = std::min(chunkSize, static_cast<std::size_t>(last - current));
+		input = reinterpret_cast<const AlphabetType *>(std::to_address(current));
+		current += static_cast<difference_type>(size);
+	}
+	else
+	{
+		size = 0;
+		for (; size != chunkSize && current != last; ++current)
+		{
+			staging[size++] = static_cast<AlphabetType>(*current);
+		}
+		input = staging.data();
+	}
+
+	// pad and incomplete block only at the end of data
+	bufferSize = (current == last)
+			? view->decode(input, size, buffer.data())
+			: view->decodeBlocks(input, size, buffer.data());
+}
+
+} // namespace base_coder
+
+#endif // defined(__cpp_lib_ranges)
+
+#endif // BASECODER_RANGES_HPP
@@ -0,0 +1,2557 @@
+#ifndef BASECODER_SIMD_HPP
+#define BASECODER_SIMD_HPP
+
+#include <BaseCoder/Cpu.hpp>
+#include <BaseCoder/Traits.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if BASECODER_SIMD
+#include <immintrin.h>
+#endif
+
+namespace base_coder
+{
+
+namespace simd
+{
+
+///
+/// \brief isBase64Layout
+/// \tparam Trait
+/// \return true if alphabet is "A-Za-z0-9" followed by two ASCII characters,
+/// which allows range-based mapping of indices
+///
+template<typename Trait>
+constexpr bool isBase64Layout()
+{
+	if (Trait::type != Type::Base64 || Trait::alphabetSize != 64)
+	{
+		return false;
+	}
+	for (std::size_t i = 0; i < 62; ++i)
+	{
+		const char expected = (i < 26) ? static_cast<char>('A' + i)
+				: (i < 52) ? static_cast<char>('a' + i - 26)
+				: static_cast<char>('0' + i - 52);
+		if (Trait::alphabet[i] != expected)
+		{
+			return false;
+		}
+	}
+	return static_cast<unsigned char>(Trait::alphabet[62]) < 0x80
+			&& static_cast<unsigned char>(Trait::alphabet[63]) < 0x80;
+}
+
+///
+/// \brief isBase16Layout
+/// \tparam Trait
+/// \return true if alphabet is "0-9A-F" or "0-9a-f" and letters of both cases are
+/// decoded, which allows arithmetic decoding
+///
+template<typename Trait>
+constexpr bool isBase16Layout()
+{
+	if (Trait::type != Type::Base16 || Trait::alphabetSize != 16)
+	{
+		return false;
+	}
+	for (std::size_t i = 0; i < 16; ++i)
+	{
+		const char character = Trait::alphabet[i];
+		if (character != "0123456789ABCDEF"[i] && character != "0123456789abcdef"[i])
+		{
+			return false;
+		}
+		if (Trait::reverseAlphabet[static_cast<std::uint8_t>(character ^ 0x20)] != i
+				&& i >= 10)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+///
+/// \brief base32FirstRun
+/// \tparam Trait
+/// \return count of leading alphabet characters which are consecutive ASCII codes
+///
+template<typename Trait>
+constexpr std::size_t base32FirstRun()
+{
+	std::size_t count = 1;
+	while (count < Trait::alphabetSize
+			&& Trait::alphabet[count] == Trait::alphabet[count - 1] + 1)
+	{
+		++count;
+	}
+	return count;
+}
+
+///
+/// \brief isBase32Layout
+/// \tparam Trait
+/// \return true if alphabet is two runs of consecutive ASCII characters,
+/// like "A-Z2-7" or "0-9A-V", which allows range-based mapping of characters
+///
+template<typename Trait>
+constexpr bool isBase32Layout()
+{
+	if (Trait::type != Type::Base32 || Trait::alphabetSize != 32)
+	{
+		return false;
+	}
+	const std::size_t first = base32FirstRun<Trait>();
+	for (std::size_t i = first + 1; i < Trait::alphabetSize; ++i)
+	{
+		if (Trait::alphabet[i] != Trait::alphabet[i - 1] + 1)
+		{
+			return false;
+		}
+	}
+	return static_cast<unsigned char>(Trait::alphabet[0]) < 0x80
+			&& static_cast<unsigned char>(Trait::alphabet[31]) < 0x80;
+}
+
+///
+/// \brief isAsciiAlphabet
+/// \tparam Trait
+/// \return true if all characters of alphabet are ASCII, which allows table
+/// lookup of any alphabet in vector registers
+///
+template<typename Trait>
+constexpr bool isAsciiAlphabet()
+{
+	for (std::size_t i = 0; i < Trait::alphabetSize; ++i)
+	{
+		if (static_cast<unsigned char>(Trait::alphabet[i]) >= 0x80)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+///
+/// \brief isConsecutiveAlphabet
+/// \tparam Trait
+/// \return true if alphabet is a range of ASCII characters, like the one of
+/// Ascii85
+///
+template<typename Trait>
+constexpr bool isConsecutiveAlphabet()
+{
+	for (std::size_t i = 1; i < Trait::alphabetSize; ++i)
+	{
+		if (Trait::alphabet[i] != Trait::alphabet[i - 1] + 1)
+		{
+			return false;
+		}
+	}
+	return static_cast<unsigned char>(Trait::alphabet[Trait::alphabetSize - 1]) < 0x80;
+}
+
+#if BASECODER_SIMD
+
+namespace detail
+{
+
+template<typename Trait>
+constexpr char char62 = Trait::alphabet[62];
+
+template<typename Trait>
+constexpr char char63 = Trait::alphabet[63];
+
+// table lookup for alphabets without layout of ranges
+
+///
+/// \brief makeAsciiDecodeTable
+/// \tparam Trait
+/// \return pshufb rows: ASCII character -> index with high bit set, zero for pad
+/// and invalid characters
+///
+template<typename Trait>
+constexpr std::array<std::uint8_t, 128> makeAsciiDecodeTable()
+{
+	std::array<std::uint8_t, 128> table{};
+	for (std::size_t i = 0; i < table.size(); ++i)
+	{
+		const std::uint8_t index = Trait::reverseAlphabet[i];
+		table[i] = (index < Trait::alphabetSize) ? static_cast<std::uint8_t>(index | 0x80) : 0;
+	}
+	return table;
+}
+
+///
+/// \brief makeAsciiDecodeRows
+/// \tparam Trait
+/// \return bit mask of 16-character rows of ASCII with alphabet characters,
+/// lookup in other rows is skipped
+///
+template<typename Trait>
+constexpr unsigned makeAsciiDecodeRows()
+{
+	unsigned rows = 0;
+	for (std::size_t i = 0; i < 128; ++i)
+	{
+		if (Trait::reverseAlphabet[i] < Trait::alphabetSize)
+		{
+			rows |= 1u << (i >> 4);
+		}
+	}
+	return rows;
+}
+
+template<typename Trait>
+constexpr std::array<std::uint8_t, 128> asciiDecodeTable = makeAsciiDecodeTable<Trait>();
+
+template<typename Trait>
+constexpr unsigned asciiDecodeRows = makeAsciiDecodeRows<Trait>();
+
+///
+/// \brief tableEncodeLookup: indices -> characters by pshufb of 16-character rows
+/// \param indices
+///
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+inline __m128i tableEncodeLookup(__m128i indices)
+{
+	// indices of other rows don't become 0..15 and are moved to 0x80.. to be zeroed
+	__m128i result = _mm_setzero_si128();
+	for (std::size_t row = 0; row != Trait::alphabetSize / 16; ++row)
+	{
+		const __m128i lookup = _mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(Trait::alphabet + row * 16));
+		const __m128i index = _mm_adds_epu8(_mm_xor_si128(indices
+				, _mm_set1_epi8(static_cast<char>(row << 4))), _mm_set1_epi8(0x70));
+		result = _mm_or_si128(result, _mm_shuffle_epi8(lookup, index));
+	}
+	return result;
+}
+
+///
+/// \brief tableDecodeLookup: characters -> indices by pshufb of 16-character rows
+/// \param input
+/// \return indices of characters, high bit is set for pad and invalid characters
+///
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+inline __m128i tableDecodeLookup(__m128i input)
+{
+	// only found characters have high bit, non-ASCII input is zeroed in any row
+	__m128i result = _mm_setzero_si128();
+	for (std::size_t row = 0; row != 8; ++row)
+	{
+		if (asciiDecodeRows<Trait> & (1u << row))
+		{
+			const __m128i lookup = _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+					asciiDecodeTable<Trait>.data() + row * 16));
+			const __m128i index = _mm_adds_epu8(_mm_xor_si128(input
+					, _mm_set1_epi8(static_cast<char>(row << 4))), _mm_set1_epi8(0x70));
+			result = _mm_or_si128(result, _mm_shuffle_epi8(lookup, index));
+		}
+	}
+	return _mm_xor_si128(result, _mm_set1_epi8(static_cast<char>(0x80)));
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+inline __m256i tableEncodeLookup(__m256i indices)
+{
+	__m256i result = _mm256_setzero_si256();
+	for (std::size_t row = 0; row != Trait::alphabetSize / 16; ++row)
+	{
+		const __m256i lookup = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(Trait::alphabet + row * 16)));
+		const __m256i index = _mm256_adds_epu8(_mm256_xor_si256(indices
+				, _mm256_set1_epi8(static_cast<char>(row << 4))), _mm256_set1_epi8(0x70));
+		result = _mm256_or_si256(result, _mm256_shuffle_epi8(lookup, index));
+	}
+	return result;
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+inline __m256i tableDecodeLookup(__m256i input)
+{
+	__m256i result = _mm256_setzero_si256();
+	for (std::size_t row = 0; row != 8; ++row)
+	{
+		if (asciiDecodeRows<Trait> & (1u << row))
+		{
+			const __m256i lookup = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+					reinterpret_cast<const __m128i *>(asciiDecodeTable<Trait>.data() + row * 16)));
+			const __m256i index = _mm256_adds_epu8(_mm256_xor_si256(input
+					, _mm256_set1_epi8(static_cast<char>(row << 4))), _mm256_set1_epi8(0x70));
+			result = _mm256_or_si256(result, _mm256_shuffle_epi8(lookup, index));
+		}
+	}
+	return _mm256_xor_si256(result, _mm256_set1_epi8(static_cast<char>(0x80)));
+}
+
+// SSSE3
+
+BASECODER_TARGET("ssse3")
+inline __m128i base64EncodeUnpack(__m128i input)
+{
+	// 12 bytes -> 16 indices
+	input = _mm_shuffle_epi8(input, _mm_set_epi8(
+			10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+	const __m128i t0 = _mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00));
+	const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+	const __m128i t2 = _mm_and_si128(input, _mm_set1_epi32(0x003F03F0));
+	const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+	return _mm_or_si128(t1, t3);
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+inline __m128i base64EncodeLookup(__m128i indices)
+{
+	if constexpr (!isBase64Layout<Trait>())
+	{
+		return tableEncodeLookup<Trait>(indices);
+	}
+
+	// 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+	const __m128i offsetLut = _mm_setr_epi8(
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52
+			, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52
+			, char62<Trait> - 62, char63<Trait> - 63, 'A', 0, 0);
+	__m128i offsetIndex = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+	const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+	offsetIndex = _mm_or_si128(offsetIndex, _mm_and_si128(less, _mm_set1_epi8(13)));
+	return _mm_add_epi8(_mm_shuffle_epi8(offsetLut, offsetIndex), indices);
+}
+
+BASECODER_TARGET("ssse3")
+inline __m128i inRange(__m128i input, char first, char last)
+{
+	return _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8(first - 1))
+			, _mm_cmpgt_epi8(_mm_set1_epi8(last + 1), input));
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+inline bool base64DecodeLookup(__m128i input, __m128i &values)
+{
+	if constexpr (!isBase64Layout<Trait>())
+	{
+		values = tableDecodeLookup<Trait>(input);
+		return _mm_movemask_epi8(values) == 0;
+	}
+
+	const __m128i upper = inRange(input, 'A', 'Z');
+	const __m128i lower = inRange(input, 'a', 'z');
+	const __m128i digit = inRange(input, '0', '9');
+	const __m128i is62 = _mm_cmpeq_epi8(input, _mm_set1_epi8(char62<Trait>));
+	const __m128i is63 = _mm_cmpeq_epi8(input, _mm_set1_epi8(char63<Trait>));
+
+	const __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower)
+			, _mm_or_si128(digit, _mm_or_si128(is62, is63)));
+	if (_mm_movemask_epi8(valid) != 0xFFFF)
+	{
+		return false;
+	}
+
+	__m128i shift = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+	shift = _mm_or_si128(shift, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+	shift = _mm_or_si128(shift, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+	shift = _mm_or_si128(shift, _mm_and_si128(is62, _mm_set1_epi8(62 - char62<Trait>)));
+	shift = _mm_or_si128(shift, _mm_and_si128(is63, _mm_set1_epi8(63 - char63<Trait>)));
+	values = _mm_add_epi8(input, shift);
+	return true;
+}
+
+BASECODER_TARGET("ssse3")
+inline __m128i base64DecodePack(__m128i values)
+{
+	// 16 indices -> 12 bytes in low part
+	const __m128i merged = _mm_madd_epi16(
+			_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140))
+			, _mm_set1_epi32(0x00011000));
+	return _mm_shuffle_epi8(merged, _mm_setr_epi8(
+			2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+std::size_t base64EncodeSsse3(const std::uint8_t *input, std::size_t size, char *output)
+{
+	std::size_t position = 0;
+	for (; size - position >= 16; position += 12, output += 16)
+	{
+		const __m128i data = _mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(input + position));
+		const __m128i result = base64EncodeLookup<Trait>(base64EncodeUnpack(data));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output), result);
+	}
+	return position;
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+std::size_t base64DecodeSsse3(const char *input, std::size_t size, std::uint8_t *output)
+{
+	std::size_t position = 0;
+	for (; size - position >= 24; position += 16, output += 12)
+	{
+		__m128i values;
+		if (!base64DecodeLookup<Trait>(_mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(input + position)), values))
+		{
+			break;
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output), base64DecodePack(values));
+	}
+	return position;
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+inline __m128i base64Invalid(__m128i input)
+{
+	if constexpr (!isBase64Layout<Trait>())
+	{
+		return tableDecodeLookup<Trait>(input);
+	}
+
+	const __m128i valid = _mm_or_si128(
+			_mm_or_si128(inRange(input, 'A', 'Z'), inRange(input, 'a', 'z'))
+			, _mm_or_si128(inRange(input, '0', '9')
+					, _mm_or_si128(_mm_cmpeq_epi8(input, _mm_set1_epi8(char62<Trait>))
+							, _mm_cmpeq_epi8(input, _mm_set1_epi8(char63<Trait>)))));
+	return _mm_cmpeq_epi8(valid, _mm_setzero_si128());
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+std::size_t base64ValidateSsse3(const char *input, std::size_t size)
+{
+	std::size_t position = 0;
+	// error masks of four vectors are accumulated before the branch
+	for (; size - position >= 64; position += 64)
+	{
+		const auto *data = reinterpret_cast<const __m128i *>(input + position);
+		const __m128i error = _mm_or_si128(
+				_mm_or_si128(base64Invalid<Trait>(_mm_loadu_si128(data))
+						, base64Invalid<Trait>(_mm_loadu_si128(data + 1)))
+				, _mm_or_si128(base64Invalid<Trait>(_mm_loadu_si128(data + 2))
+						, base64Invalid<Trait>(_mm_loadu_si128(data + 3))));
+		if (_mm_movemask_epi8(error))
+		{
+			break;
+		}
+	}
+	for (; size - position >= 16; position += 16)
+	{
+		if (_mm_movemask_epi8(base64Invalid<Trait>(_mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(input + position)))))
+		{
+			break;
+		}
+	}
+	return position;
+}
+
+// AVX2
+
+BASECODER_TARGET("avx2")
+inline __m256i base64EncodeUnpack(__m256i input)
+{
+	input = _mm256_shuffle_epi8(input, _mm256_set_epi8(
+			10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1
+			, 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+	const __m256i t0 = _mm256_and_si256(input, _mm256_set1_epi32(0x0FC0FC00));
+	const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+	const __m256i t2 = _mm256_and_si256(input, _mm256_set1_epi32(0x003F03F0));
+	const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+	return _mm256_or_si256(t1, t3);
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+inline __m256i base64EncodeLookup(__m256i indices)
+{
+	if constexpr (!isBase64Layout<Trait>())
+	{
+		return tableEncodeLookup<Trait>(indices);
+	}
+
+	const __m256i offsetLut = _mm256_setr_epi8(
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52
+			, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52
+			, char62<Trait> - 62, char63<Trait> - 63, 'A', 0, 0
+			, 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52
+			, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52
+			, char62<Trait> - 62, char63<Trait> - 63, 'A', 0, 0);
+	__m256i offsetIndex = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+	const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+	offsetIndex = _mm256_or_si256(offsetIndex
+			, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+	return _mm256_add_epi8(_mm256_shuffle_epi8(offsetLut, offsetIndex), indices);
+}
+
+BASECODER_TARGET("avx2")
+inline __m256i inRange(__m256i input, char first, char last)
+{
+	return _mm256_and_si256(_mm256_cmpgt_epi8(input, _mm256_set1_epi8(first - 1))
+			, _mm256_cmpgt_epi8(_mm256_set1_epi8(last + 1), input));
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+inline bool base64DecodeLookup(__m256i input, __m256i &values)
+{
+	if constexpr (!isBase64Layout<Trait>())
+	{
+		values = tableDecodeLookup<Trait>(input);
+		return _mm256_movemask_epi8(values) == 0;
+	}
+
+	const __m256i upper = inRange(input, 'A', 'Z');
+	const __m256i lower = inRange(input, 'a', 'z');
+	const __m256i digit = inRange(input, '0', '9');
+	const __m256i is62 = _mm256_cmpeq_epi8(input, _mm256_set1_epi8(char62<Trait>));
+	const __m256i is63 = _mm256_cmpeq_epi8(input, _mm256_set1_epi8(char63<Trait>));
+
+	const __m256i valid = _mm256_or_si256(_mm256_or_si256(upper, lower)
+			, _mm256_or_si256(digit, _mm256_or_si256(is62, is63)));
+	if (_mm256_movemask_epi8(valid) != -1)
+	{
+		return false;
+	}
+
+	__m256i shift = _mm256_and_si256(upper, _mm256_set1_epi8(-'A'));
+	shift = _mm256_or_si256(shift, _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a')));
+	shift = _mm256_or_si256(shift, _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')));
+	shift = _mm256_or_si256(shift
+			, _mm256_and_si256(is62, _mm256_set1_epi8(62 - char62<Trait>)));
+	shift = _mm256_or_si256(shift
+			, _mm256_and_si256(is63, _mm256_set1_epi8(63 - char63<Trait>)));
+	values = _mm256_add_epi8(input, shift);
+	return true;
+}
+
+BASECODER_TARGET("avx2")
+inline __m256i base64DecodePack(__m256i values)
+{
+	// 32 indices -> 24 bytes in low part
+	const __m256i merged = _mm256_madd_epi16(
+			_mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140))
+			, _mm256_set1_epi32(0x00011000));
+	const __m256i packed = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(
+			2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+			, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+	return _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+std::size_t base64EncodeAvx2(const std::uint8_t *input, std::size_t size, char *output)
+{
+	std::size_t position = 0;
+	for (; size - position >= 28; position += 24, output += 32)
+	{
+		const __m128i low = _mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(input + position));
+		const __m128i high = _mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(input + position + 12));
+		const __m256i data = _mm256_inserti128_si256(
+				_mm256_castsi128_si256(low), high, 1);
+		const __m256i result = base64EncodeLookup<Trait>(base64EncodeUnpack(data));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output), result);
+	}
+	return position + base64EncodeSsse3<Trait>(input + position, size - position, output);
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+std::size_t base64DecodeAvx2(const char *input, std::size_t size, std::uint8_t *output)
+{
+	std::size_t position = 0;
+	for (; size - position >= 48; position += 32, output += 24)
+	{
+		__m256i values;
+		if (!base64DecodeLookup<Trait>(_mm256_loadu_si256(
+				reinterpret_cast<const __m256i *>(input + position)), values))
+		{
+			return position;
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output), base64DecodePack(values));
+	}
+	return position + base64DecodeSsse3<Trait>(input + position, size - position, output);
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+inline __m256i base64Invalid(__m256i input)
+{
+	if constexpr (!isBase64Layout<Trait>())
+	{
+		return tableDecodeLookup<Trait>(input);
+	}
+
+	const __m256i valid = _mm256_or_si256(
+			_mm256_or_si256(inRange(input, 'A', 'Z'), inRange(input, 'a', 'z'))
+			, _mm256_or_si256(inRange(input, '0', '9')
+					, _mm256_or_si256(
+							_mm256_cmpeq_epi8(input, _mm256_set1_epi8(char62<Trait>))
+							, _mm256_cmpeq_epi8(input, _mm256_set1_epi8(char63<Trait>)))));
+	return _mm256_cmpeq_epi8(valid, _mm256_setzero_si256());
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+std::size_t base64ValidateAvx2(const char *input, std::size_t size)
+{
+	std::size_t position = 0;
+	for (; size - position >= 128; position += 128)
+	{
+		const auto *data = reinterpret_cast<const __m256i *>(input + position);
+		const __m256i error = _mm256_or_si256(
+				_mm256_or_si256(base64Invalid<Trait>(_mm256_loadu_si256(data))
+						, base64Invalid<Trait>(_mm256_loadu_si256(data + 1)))
+				, _mm256_or_si256(base64Invalid<Trait>(_mm256_loadu_si256(data + 2))
+						, base64Invalid<Trait>(_mm256_loadu_si256(data + 3))));
+		if (_mm256_movemask_epi8(error))
+		{
+			break;
+		}
+	}
+	for (; size - position >= 32; position += 32)
+	{
+		if (_mm256_movemask_epi8(base64Invalid<Trait>(_mm256_loadu_si256(
+				reinterpret_cast<const __m256i *>(input + position)))))
+		{
+			return position;
+		}
+	}
+	return position + base64ValidateSsse3<Trait>(input + position, size - position);
+}
+
+// AVX-512
+
+template<typename Trait>
+BASECODER_TARGET("avx512f,avx512bw")
+std::size_t base64EncodeAvx512(const std::uint8_t *input, std::size_t size, char *output)
+{
+	const __m512i spread = _mm512_setr_epi32(
+			0, 1, 2, 3, 3, 4, 5, 6, 6, 7, 8, 9, 9, 10, 11, 12);
+	const __m512i shuffle = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_set_epi8(
+			10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+	const __m512i offsetLut = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_setr_epi8(
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52
+			, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52
+			, char62<Trait> - 62, char63<Trait> - 63, 'A', 0, 0));
+
+	std::size_t position = 0;
+	for (; size - position >= 48; position += 48, output += 64)
+	{
+		__m512i data = _mm512_maskz_loadu_epi8(0x0000FFFFFFFFFFFF, input + position);
+		data = _mm512_maskz_permutexvar_epi32(0xFFFF, spread, data);
+		data = _mm512_shuffle_epi8(data, shuffle);
+
+		const __m512i t0 = _mm512_and_si512(data, _mm512_set1_epi32(0x0FC0FC00));
+		const __m512i t1 = _mm512_mulhi_epu16(t0, _mm512_set1_epi32(0x04000040));
+		const __m512i t2 = _mm512_and_si512(data, _mm512_set1_epi32(0x003F03F0));
+		const __m512i t3 = _mm512_mullo_epi16(t2, _mm512_set1_epi32(0x01000010));
+		const __m512i indices = _mm512_or_si512(t1, t3);
+
+		__m512i offsetIndex = _mm512_subs_epu8(indices, _mm512_set1_epi8(51));
+		offsetIndex = _mm512_mask_mov_epi8(offsetIndex
+				, _mm512_cmplt_epu8_mask(indices, _mm512_set1_epi8(26))
+				, _mm512_set1_epi8(13));
+		const __m512i result = _mm512_add_epi8(
+				_mm512_shuffle_epi8(offsetLut, offsetIndex), indices);
+		_mm512_storeu_si512(output, result);
+	}
+	return position;
+}
+
+BASECODER_TARGET("avx512f,avx512bw")
+inline __mmask64 inRange(__m512i input, char first, char last)
+{
+	return _mm512_cmplt_epu8_mask(_mm512_sub_epi8(input, _mm512_set1_epi8(first))
+			, _mm512_set1_epi8(last - first + 1));
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx512f,avx512bw")
+std::size_t base64DecodeAvx512(const char *input, std::size_t size, std::uint8_t *output)
+{
+	const __m512i pack = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_setr_epi8(
+			2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+	const __m512i compact = _mm512_setr_epi32(
+			0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 15, 15, 15);
+
+	std::size_t position = 0;
+	for (; size - position >= 64; position += 64, output += 48)
+	{
+		const __m512i data = _mm512_loadu_si512(input + position);
+		const __mmask64 upper = inRange(data, 'A', 'Z');
+		const __mmask64 lower = inRange(data, 'a', 'z');
+		const __mmask64 digit = inRange(data, '0', '9');
+		const __mmask64 is62 = _mm512_cmpeq_epi8_mask(data, _mm512_set1_epi8(char62<Trait>));
+		const __mmask64 is63 = _mm512_cmpeq_epi8_mask(data, _mm512_set1_epi8(char63<Trait>));
+		if ((upper | lower | digit | is62 | is63) != ~__mmask64{})
+		{
+			return position;
+		}
+
+		__m512i shift = _mm512_maskz_mov_epi8(upper, _mm512_set1_epi8(-'A'));
+		shift = _mm512_mask_mov_epi8(shift, lower, _mm512_set1_epi8(26 - 'a'));
+		shift = _mm512_mask_mov_epi8(shift, digit, _mm512_set1_epi8(52 - '0'));
+		shift = _mm512_mask_mov_epi8(shift, is62, _mm512_set1_epi8(62 - char62<Trait>));
+		shift = _mm512_mask_mov_epi8(shift, is63, _mm512_set1_epi8(63 - char63<Trait>));
+		const __m512i values = _mm512_add_epi8(data, shift);
+
+		const __m512i merged = _mm512_madd_epi16(
+				_mm512_maddubs_epi16(values, _mm512_set1_epi32(0x01400140))
+				, _mm512_set1_epi32(0x00011000));
+		const __m512i result = _mm512_maskz_permutexvar_epi32(0xFFFF, compact
+				, _mm512_shuffle_epi8(merged, pack));
+		_mm512_mask_storeu_epi8(output, 0x0000FFFFFFFFFFFF, result);
+	}
+	return position;
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx512f,avx512bw")
+inline __mmask64 base64Invalid(__m512i input)
+{
+	return ~(inRange(input, 'A', 'Z') | inRange(input, 'a', 'z') | inRange(input, '0', '9')
+			| _mm512_cmpeq_epi8_mask(input, _mm512_set1_epi8(char62<Trait>))
+			| _mm512_cmpeq_epi8_mask(input, _mm512_set1_epi8(char63<Trait>)));
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx512f,avx512bw")
+std::size_t base64ValidateAvx512(const char *input, std::size_t size)
+{
+	std::size_t position = 0;
+	for (; size - position >= 256; position += 256)
+	{
+		const char *data = input + position;
+		const __mmask64 error = base64Invalid<Trait>(_mm512_loadu_si512(data))
+				| base64Invalid<Trait>(_mm512_loadu_si512(data + 64))
+				| base64Invalid<Trait>(_mm512_loadu_si512(data + 128))
+				| base64Invalid<Trait>(_mm512_loadu_si512(data + 192));
+		if (error)
+		{
+			break;
+		}
+	}
+	for (; size - position >= 64; position += 64)
+	{
+		if (base64Invalid<Trait>(_mm512_loadu_si512(input + position)))
+		{
+			break;
+		}
+	}
+	return position;
+}
+
+// AVX-512 VBMI
+
+///
+/// \brief makeVbmiEncodeShuffle
+/// \return vpermb indices gathering 3-byte groups as {1, 0, 2, 1} for multishift
+///
+constexpr std::array<std::uint8_t, 64> makeVbmiEncodeShuffle()
+{
+	std::array<std::uint8_t, 64> shuffle{};
+	for (std::size_t group = 0; group < 16; ++group)
+	{
+		shuffle[group * 4 + 0] = static_cast<std::uint8_t>(group * 3 + 1);
+		shuffle[group * 4 + 1] = static_cast<std::uint8_t>(group * 3 + 0);
+		shuffle[group * 4 + 2] = static_cast<std::uint8_t>(group * 3 + 2);
+		shuffle[group * 4 + 3] = static_cast<std::uint8_t>(group * 3 + 1);
+	}
+	return shuffle;
+}
+
+///
+/// \brief makeVbmiDecodePack
+/// \return vpermb indices taking 3 big-endian bytes from each 24-bit dword
+///
+constexpr std::array<std::uint8_t, 64> makeVbmiDecodePack()
+{
+	std::array<std::uint8_t, 64> pack{};
+	for (std::size_t i = 0; i < 48; ++i)
+	{
+		pack[i] = static_cast<std::uint8_t>(i / 3 * 4 + 2 - i % 3);
+	}
+	return pack;
+}
+
+///
+/// \brief makeVbmiDecodeLookup
+/// \tparam Trait
+/// \return vpermi2b table: ASCII character -> index, 0x80 for pad and invalid
+///
+template<typename Trait>
+constexpr std::array<std::uint8_t, 128> makeVbmiDecodeLookup()
+{
+	std::array<std::uint8_t, 128> lookup{};
+	for (std::size_t i = 0; i < lookup.size(); ++i)
+	{
+		const std::uint8_t index = Trait::reverseAlphabet[i];
+		lookup[i] = (index < Trait::alphabetSize) ? index : 0x80;
+	}
+	return lookup;
+}
+
+constexpr std::array<std::uint8_t, 64> vbmiEncodeShuffle = makeVbmiEncodeShuffle();
+constexpr std::array<std::uint8_t, 64> vbmiDecodePack = makeVbmiDecodePack();
+
+template<typename Trait>
+constexpr std::array<std::uint8_t, 128> vbmiDecodeLookup = makeVbmiDecodeLookup<Trait>();
+
+template<typename Trait>
+BASECODER_TARGET("avx512f,avx512bw,avx512vbmi")
+std::size_t base64EncodeAvx512Vbmi(const std::uint8_t *input, std::size_t size
+		, char *output)
+{
+	const __m512i shuffle = _mm512_loadu_si512(vbmiEncodeShuffle.data());
+	const __m512i alphabet = _mm512_loadu_si512(Trait::alphabet);
+	// bit offsets of 6-bit fields in {1, 0, 2, 1} byte groups
+	const __m512i shifts = _mm512_set1_epi64(0x3036242A1016040A);
+	const __mmask64 allLanes = ~__mmask64{};
+
+	std::size_t position = 0;
+	for (; size - position >= 48; position += 48, output += 64)
+	{
+		__m512i data = _mm512_maskz_loadu_epi8(0x0000FFFFFFFFFFFF, input + position);
+		data = _mm512_maskz_permutexvar_epi8(allLanes, shuffle, data);
+		const __m512i indices = _mm512_maskz_multishift_epi64_epi8(allLanes, shifts, data);
+		_mm512_storeu_si512(output
+				, _mm512_maskz_permutexvar_epi8(allLanes, indices, alphabet));
+	}
+	return position;
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx512f,avx512bw,avx512vbmi")
+std::size_t base64DecodeAvx512Vbmi(const char *input, std::size_t size
+		, std::uint8_t *output)
+{
+	const __m512i lookupLow = _mm512_loadu_si512(vbmiDecodeLookup<Trait>.data());
+	const __m512i lookupHigh = _mm512_loadu_si512(vbmiDecodeLookup<Trait>.data() + 64);
+	const __m512i pack = _mm512_loadu_si512(vbmiDecodePack.data());
+	const __mmask64 allLanes = ~__mmask64{};
+
+	std::size_t position = 0;
+	for (; size - position >= 64; position += 64, output += 48)
+	{
+		const __m512i data = _mm512_loadu_si512(input + position);
+		const __m512i values = _mm512_permutex2var_epi8(lookupLow, data, lookupHigh);
+		// high bit is set for non-ASCII input and for pad/invalid lookup result
+		if (_mm512_movepi8_mask(_mm512_or_si512(data, values)))
+		{
+			break;
+		}
+
+		const __m512i merged = _mm512_madd_epi16(
+				_mm512_maddubs_epi16(values, _mm512_set1_epi32(0x01400140))
+				, _mm512_set1_epi32(0x00011000));
+		_mm512_mask_storeu_epi8(output, 0x0000FFFFFFFFFFFF
+				, _mm512_maskz_permutexvar_epi8(allLanes, pack, merged));
+	}
+	return position;
+}
+
+BASECODER_TARGET("avx512f,avx512bw,avx512vbmi")
+inline __m512i vbmiInvalid(const char *input, __m512i lookupLow, __m512i lookupHigh)
+{
+	// high bit is set for non-ASCII input and for pad/invalid lookup result
+	const __m512i data = _mm512_loadu_si512(input);
+	return _mm512_or_si512(data, _mm512_permutex2var_epi8(lookupLow, data, lookupHigh));
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx512f,avx512bw,avx512vbmi")
+std::size_t base64ValidateAvx512Vbmi(const char *input, std::size_t size)
+{
+	const __m512i low = _mm512_loadu_si512(vbmiDecodeLookup<Trait>.data());
+	const __m512i high = _mm512_loadu_si512(vbmiDecodeLookup<Trait>.data() + 64);
+
+	std::size_t position = 0;
+	for (; size - position >= 256; position += 256)
+	{
+		const char *data = input + position;
+		const __m512i error = _mm512_or_si512(
+				_mm512_or_si512(vbmiInvalid(data, low, high)
+						, vbmiInvalid(data + 64, low, high))
+				, _mm512_or_si512(vbmiInvalid(data + 128, low, high)
+						, vbmiInvalid(data + 192, low, high)));
+		if (_mm512_movepi8_mask(error))
+		{
+			break;
+		}
+	}
+	for (; size - position >= 64; position += 64)
+	{
+		if (_mm512_movepi8_mask(vbmiInvalid(input + position, low, high)))
+		{
+			break;
+		}
+	}
+	return position;
+}
+
+// Base32
+
+template<typename Trait>
+constexpr std::size_t base32FirstSize = base32FirstRun<Trait>();
+
+template<typename Trait>
+constexpr char base32First = Trait::alphabet[0];
+
+template<typename Trait>
+constexpr char base32Second = Trait::alphabet[base32FirstSize<Trait>];
+
+///
+/// \brief base32EncodeUnpack: two 5-byte groups -> 16 indices
+/// \param input bytes of groups at offsets 0 and 5
+///
+BASECODER_TARGET("ssse3")
+inline __m128i base32EncodeUnpack(__m128i input)
+{
+	// every index is shifted out of big-endian 16-bit word holding its bits,
+	// mulhi by 2^(16 - shift) is a variable right shift
+	const __m128i first = _mm_shuffle_epi8(input, _mm_setr_epi8(
+			1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5, 4));
+	const __m128i second = _mm_shuffle_epi8(input, _mm_setr_epi8(
+			6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 10, 9));
+	const __m128i multipliers = _mm_setr_epi16(32, 1024, 128, 4096, 512, 64, 2048, 256);
+	const __m128i mask = _mm_set1_epi16(0x1F);
+	return _mm_packus_epi16(
+			_mm_and_si128(_mm_mulhi_epu16(first, multipliers), mask)
+			, _mm_and_si128(_mm_mulhi_epu16(second, multipliers), mask));
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+inline __m128i base32EncodeLookup(__m128i indices)
+{
+	// indices 16..31 are zeroed by the first lookup, 0..15 by the second one
+	const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Trait::alphabet));
+	const __m128i high = _mm_loadu_si128(
+			reinterpret_cast<const __m128i *>(Trait::alphabet + 16));
+	return _mm_or_si128(_mm_shuffle_epi8(low, _mm_adds_epu8(indices, _mm_set1_epi8(0x70)))
+			, _mm_shuffle_epi8(high, _mm_sub_epi8(indices, _mm_set1_epi8(16))));
+}
+
+///
+/// \brief base32DecodeLookup
+/// \param input
+/// \param values indices of characters, valid if high bits of result are clear
+/// \return mask of characters outside of alphabet, only high bits are meaningful
+///
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+inline __m128i base32DecodeLookup(__m128i input, __m128i &values)
+{
+	if constexpr (!isBase32Layout<Trait>())
+	{
+		values = tableDecodeLookup<Trait>(input);
+		return values;
+	}
+
+	const __m128i first = _mm_sub_epi8(input, _mm_set1_epi8(base32First<Trait>));
+	const __m128i second = _mm_sub_epi8(input, _mm_set1_epi8(base32Second<Trait>));
+	const __m128i inFirst = _mm_cmpeq_epi8(first, _mm_min_epu8(first
+			, _mm_set1_epi8(static_cast<char>(base32FirstSize<Trait> - 1))));
+	const __m128i inSecond = _mm_cmpeq_epi8(second, _mm_min_epu8(second
+			, _mm_set1_epi8(static_cast<char>(31 - base32FirstSize<Trait>))));
+	values = _mm_or_si128(_mm_and_si128(inFirst, first), _mm_and_si128(inSecond
+			, _mm_add_epi8(second, _mm_set1_epi8(static_cast<char>(base32FirstSize<Trait>)))));
+	return _mm_cmpeq_epi8(_mm_or_si128(inFirst, inSecond), _mm_setzero_si128());
+}
+
+///
+/// \brief base32DecodePack: 16 indices -> 10 bytes in low part
+///
+BASECODER_TARGET("ssse3")
+inline __m128i base32DecodePack(__m128i values)
+{
+	// 8 indices -> two 20-bit halves of 40-bit group in 64-bit lane
+	const __m128i halves = _mm_madd_epi16(
+			_mm_maddubs_epi16(values, _mm_set1_epi16(0x0120))
+			, _mm_set1_epi32(0x00010400));
+	const __m128i group = _mm_or_si128(
+			_mm_slli_epi64(_mm_and_si128(halves, _mm_set1_epi64x(0xFFFFFFFF)), 20)
+			, _mm_srli_epi64(halves, 32));
+	return _mm_shuffle_epi8(group, _mm_setr_epi8(
+			4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1));
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+std::size_t base32EncodeSsse3(const std::uint8_t *input, std::size_t size, char *output)
+{
+	std::size_t position = 0;
+	for (; size - position >= 16; position += 10, output += 16)
+	{
+		const __m128i data = _mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(input + position));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output)
+				, base32EncodeLookup<Trait>(base32EncodeUnpack(data)));
+	}
+	return position;
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+std::size_t base32DecodeSsse3(const char *input, std::size_t size, std::uint8_t *output)
+{
+	std::size_t position = 0;
+	for (; size - position >= 32; position += 16, output += 10)
+	{
+		__m128i values;
+		if (_mm_movemask_epi8(base32DecodeLookup<Trait>(_mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(input + position)), values)))
+		{
+			break;
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output), base32DecodePack(values));
+	}
+	return position;
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+std::size_t base32ValidateSsse3(const char *input, std::size_t size)
+{
+	std::size_t position = 0;
+	for (; size - position >= 16; position += 16)
+	{
+		__m128i values;
+		if (_mm_movemask_epi8(base32DecodeLookup<Trait>(_mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(input + position)), values)))
+		{
+			break;
+		}
+	}
+	return position;
+}
+
+BASECODER_TARGET("avx2")
+inline __m256i base32EncodeUnpack(__m256i input)
+{
+	const __m256i first = _mm256_shuffle_epi8(input, _mm256_setr_epi8(
+			1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5, 4
+			, 1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5, 4));
+	const __m256i second = _mm256_shuffle_epi8(input, _mm256_setr_epi8(
+			6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 10, 9
+			, 6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 10, 9));
+	const __m256i multipliers = _mm256_setr_epi16(32, 1024, 128, 4096, 512, 64, 2048, 256
+			, 32, 1024, 128, 4096, 512, 64, 2048, 256);
+	const __m256i mask = _mm256_set1_epi16(0x1F);
+	return _mm256_packus_epi16(
+			_mm256_and_si256(_mm256_mulhi_epu16(first, multipliers), mask)
+			, _mm256_and_si256(_mm256_mulhi_epu16(second, multipliers), mask));
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+inline __m256i base32EncodeLookup(__m256i indices)
+{
+	const __m256i low = _mm256_broadcastsi128_si256(
+			_mm_loadu_si128(reinterpret_cast<const __m128i *>(Trait::alphabet)));
+	const __m256i high = _mm256_broadcastsi128_si256(
+			_mm_loadu_si128(reinterpret_cast<const __m128i *>(Trait::alphabet + 16)));
+	return _mm256_or_si256(
+			_mm256_shuffle_epi8(low, _mm256_adds_epu8(indices, _mm256_set1_epi8(0x70)))
+			, _mm256_shuffle_epi8(high, _mm256_sub_epi8(indices, _mm256_set1_epi8(16))));
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+inline __m256i base32DecodeLookup(__m256i input, __m256i &values)
+{
+	if constexpr (!isBase32Layout<Trait>())
+	{
+		values = tableDecodeLookup<Trait>(input);
+		return values;
+	}
+
+	const __m256i first = _mm256_sub_epi8(input, _mm256_set1_epi8(base32First<Trait>));
+	const __m256i second = _mm256_sub_epi8(input, _mm256_set1_epi8(base32Second<Trait>));
+	const __m256i inFirst = _mm256_cmpeq_epi8(first, _mm256_min_epu8(first
+			, _mm256_set1_epi8(static_cast<char>(base32FirstSize<Trait> - 1))));
+	const __m256i inSecond = _mm256_cmpeq_epi8(second, _mm256_min_epu8(second
+			, _mm256_set1_epi8(static_cast<char>(31 - base32FirstSize<Trait>))));
+	values = _mm256_or_si256(_mm256_and_si256(inFirst, first), _mm256_and_si256(inSecond
+			, _mm256_add_epi8(second
+					, _mm256_set1_epi8(static_cast<char>(base32FirstSize<Trait>)))));
+	return _mm256_cmpeq_epi8(_mm256_or_si256(inFirst, inSecond), _mm256_setzero_si256());
+}
+
+BASECODER_TARGET("avx2")
+inline __m256i base32DecodePack(__m256i values)
+{
+	const __m256i halves = _mm256_madd_epi16(
+			_mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0120))
+			, _mm256_set1_epi32(0x00010400));
+	const __m256i group = _mm256_or_si256(
+			_mm256_slli_epi64(_mm256_and_si256(halves, _mm256_set1_epi64x(0xFFFFFFFF)), 20)
+			, _mm256_srli_epi64(halves, 32));
+	return _mm256_shuffle_epi8(group, _mm256_setr_epi8(
+			4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1
+			, 4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1));
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+std::size_t base32EncodeAvx2(const std::uint8_t *input, std::size_t size, char *output)
+{
+	std::size_t position = 0;
+	// the second lane is loaded from the third group
+	for (; size - position >= 26; position += 20, output += 32)
+	{
+		const __m256i data = _mm256_inserti128_si256(_mm256_castsi128_si256(
+				_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + position)))
+				, _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + position + 10))
+				, 1);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output)
+				, base32EncodeLookup<Trait>(base32EncodeUnpack(data)));
+	}
+	return position + base32EncodeSsse3<Trait>(input + position, size - position, output);
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+std::size_t base32DecodeAvx2(const char *input, std::size_t size, std::uint8_t *output)
+{
+	std::size_t position = 0;
+	// lanes are stored separately, 16 bytes each
+	for (; size - position >= 48; position += 32, output += 20)
+	{
+		__m256i values;
+		if (_mm256_movemask_epi8(base32DecodeLookup<Trait>(_mm256_loadu_si256(
+				reinterpret_cast<const __m256i *>(input + position)), values)))
+		{
+			break;
+		}
+		const __m256i result = base32DecodePack(values);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output)
+				, _mm256_castsi256_si128(result));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output + 10)
+				, _mm256_extracti128_si256(result, 1));
+	}
+	return position + base32DecodeSsse3<Trait>(input + position, size - position, output);
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+std::size_t base32ValidateAvx2(const char *input, std::size_t size)
+{
+	std::size_t position = 0;
+	for (; size - position >= 32; position += 32)
+	{
+		__m256i values;
+		if (_mm256_movemask_epi8(base32DecodeLookup<Trait>(_mm256_loadu_si256(
+				reinterpret_cast<const __m256i *>(input + position)), values)))
+		{
+			break;
+		}
+	}
+	return position + base32ValidateSsse3<Trait>(input + position, size - position);
+}
+
+///
+/// \brief makeBase32VbmiGather
+/// \return permutation: 5-byte group -> big-endian 40-bit number in 64-bit lane
+///
+constexpr std::array<std::uint8_t, 64> makeBase32VbmiGather()
+{
+	std::array<std::uint8_t, 64> gather{};
+	for (std::size_t group = 0; group < 8; ++group)
+	{
+		for (std::size_t i = 0; i < 5; ++i)
+		{
+			gather[group * 8 + i] = static_cast<std::uint8_t>(group * 5 + 4 - i);
+		}
+	}
+	return gather;
+}
+
+///
+/// \brief makeBase32VbmiPack
+/// \return permutation: 40-bit numbers in 64-bit lanes -> 5-byte groups
+///
+constexpr std::array<std::uint8_t, 64> makeBase32VbmiPack()
+{
+	std::array<std::uint8_t, 64> pack{};
+	for (std::size_t group = 0; group < 8; ++group)
+	{
+		for (std::size_t i = 0; i < 5; ++i)
+		{
+			pack[group * 5 + i] = static_cast<std::uint8_t>(group * 8 + 4 - i);
+		}
+	}
+	return pack;
+}
+
+constexpr std::array<std::uint8_t, 64> base32VbmiGather = makeBase32VbmiGather();
+constexpr std::array<std::uint8_t, 64> base32VbmiPack = makeBase32VbmiPack();
+
+template<typename Trait>
+BASECODER_TARGET("avx512f,avx512bw,avx512vbmi")
+std::size_t base32EncodeAvx512Vbmi(const std::uint8_t *input, std::size_t size
+		, char *output)
+{
+	const __m512i gather = _mm512_loadu_si512(base32VbmiGather.data());
+	// bit offsets of 8 indices in 40-bit number: 35, 30, ... 0
+	const __m512i shifts = _mm512_set1_epi64(0x00050A0F14191E23);
+	const __m512i lookup = _mm512_maskz_loadu_epi8(0xFFFFFFFF, Trait::alphabet);
+	const __mmask64 allLanes = ~__mmask64{};
+
+	std::size_t position = 0;
+	for (; size - position >= 40; position += 40, output += 64)
+	{
+		const __m512i data = _mm512_maskz_loadu_epi8(0x000000FFFFFFFFFF, input + position);
+		const __m512i groups = _mm512_maskz_permutexvar_epi8(allLanes, gather, data);
+		const __m512i indices = _mm512_and_si512(
+				_mm512_maskz_multishift_epi64_epi8(allLanes, shifts, groups)
+				, _mm512_set1_epi8(0x1F));
+		_mm512_storeu_si512(output, _mm512_maskz_permutexvar_epi8(allLanes, indices, lookup));
+	}
+	return position;
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx512f,avx512bw,avx512vbmi")
+std::size_t base32DecodeAvx512Vbmi(const char *input, std::size_t size
+		, std::uint8_t *output)
+{
+	const __m512i lookupLow = _mm512_loadu_si512(vbmiDecodeLookup<Trait>.data());
+	const __m512i lookupHigh = _mm512_loadu_si512(vbmiDecodeLookup<Trait>.data() + 64);
+	const __m512i pack = _mm512_loadu_si512(base32VbmiPack.data());
+	const __mmask64 allLanes = ~__mmask64{};
+
+	std::size_t position = 0;
+	for (; size - position >= 64; position += 64, output += 40)
+	{
+		const __m512i data = _mm512_loadu_si512(input + position);
+		const __m512i values = _mm512_permutex2var_epi8(lookupLow, data, lookupHigh);
+		if (_mm512_movepi8_mask(_mm512_or_si512(data, values)))
+		{
+			break;
+		}
+
+		const __m512i halves = _mm512_madd_epi16(
+				_mm512_maddubs_epi16(values, _mm512_set1_epi16(0x0120))
+				, _mm512_set1_epi32(0x00010400));
+		const __m512i groups = _mm512_or_si512(
+				_mm512_maskz_slli_epi64(0xFF
+						, _mm512_and_si512(halves, _mm512_set1_epi64(0xFFFFFFFF)), 20)
+				, _mm512_maskz_srli_epi64(0xFF, halves, 32));
+		_mm512_mask_storeu_epi8(output, 0x000000FFFFFFFFFF
+				, _mm512_maskz_permutexvar_epi8(allLanes, pack, groups));
+	}
+	return position;
+}
+
+// whitespace compaction
+
+///
+/// \brief makeCompactShuffle
+/// \return pshufb indices of set bits of 8-bit mask, packed to the low bytes
+///
+constexpr std::array<std::uint64_t, 256> makeCompactShuffle()
+{
+	std::array<std::uint64_t, 256> shuffle{};
+	for (std::size_t mask = 0; mask < shuffle.size(); ++mask)
+	{
+		std::size_t count = 0;
+		for (std::size_t bit = 0; bit < 8; ++bit)
+		{
+			if (mask & (std::size_t{ 1 } << bit))
+			{
+				shuffle[mask] |= std::uint64_t{ bit } << (count++ * 8);
+			}
+		}
+	}
+	return shuffle;
+}
+
+constexpr std::array<std::uint64_t, 256> compactShuffle = makeCompactShuffle();
+
+///
+/// \brief hasVbmi2
+/// \return true if CPU supports vpcompressb
+///
+inline bool hasVbmi2()
+{
+	static const bool supported = __builtin_cpu_supports("avx512vbmi2");
+	return supported;
+}
+
+BASECODER_TARGET("ssse3")
+inline __m128i isWhitespace(__m128i input)
+{
+	// ' ' or one of '\t', '\n', '\v', '\f', '\r'
+	const __m128i control = _mm_sub_epi8(input, _mm_set1_epi8('\t'));
+	return _mm_or_si128(_mm_cmpeq_epi8(input, _mm_set1_epi8(' '))
+			, _mm_cmpeq_epi8(_mm_min_epu8(control, _mm_set1_epi8(4)), control));
+}
+
+///
+/// \brief compact: store bytes selected by keep mask contiguously
+/// \param input
+/// \param keep 16-bit mask of kept bytes
+/// \param output buffer for 16 characters, only returned count is meaningful
+/// \return count of stored characters
+///
+BASECODER_TARGET("ssse3")
+inline std::size_t compact(__m128i input, unsigned keep, char *output)
+{
+	const unsigned low = keep & 0xFF;
+	const unsigned high = keep >> 8;
+	const __m128i shuffle = _mm_set_epi64x(
+			static_cast<long long>(compactShuffle[high] + 0x0808080808080808)
+			, static_cast<long long>(compactShuffle[low]));
+	const __m128i packed = _mm_shuffle_epi8(input, shuffle);
+	const std::size_t lowCount = static_cast<std::size_t>(__builtin_popcount(low));
+	_mm_storel_epi64(reinterpret_cast<__m128i *>(output), packed);
+	_mm_storel_epi64(reinterpret_cast<__m128i *>(output + lowCount)
+			, _mm_unpackhi_epi64(packed, packed));
+	return lowCount + static_cast<std::size_t>(__builtin_popcount(high));
+}
+
+BASECODER_TARGET("ssse3")
+inline std::size_t stripWhitespaceSsse3(const char *input, std::size_t size, char *output
+		, std::size_t &written)
+{
+	std::size_t position = 0;
+	for (; size - position >= 16; position += 16)
+	{
+		const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+				input + position));
+		const unsigned whitespace = static_cast<unsigned>(
+				_mm_movemask_epi8(isWhitespace(data)));
+		if (whitespace == 0)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(output + written), data);
+			written += 16;
+		}
+		else
+		{
+			written += compact(data, ~whitespace & 0xFFFF, output + written);
+		}
+	}
+	return position;
+}
+
+BASECODER_TARGET("avx2")
+inline std::size_t stripWhitespaceAvx2(const char *input, std::size_t size, char *output
+		, std::size_t &written)
+{
+	const __m256i space = _mm256_set1_epi8(' ');
+	const __m256i tab = _mm256_set1_epi8('\t');
+	const __m256i four = _mm256_set1_epi8(4);
+
+	std::size_t position = 0;
+	for (; size - position >= 32; position += 32)
+	{
+		const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+				input + position));
+		const __m256i control = _mm256_sub_epi8(data, tab);
+		const unsigned whitespace = static_cast<unsigned>(_mm256_movemask_epi8(
+				_mm256_or_si256(_mm256_cmpeq_epi8(data, space)
+						, _mm256_cmpeq_epi8(_mm256_min_epu8(control, four), control))));
+		if (whitespace == 0)
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + written), data);
+			written += 32;
+		}
+		else
+		{
+			written += compact(_mm256_castsi256_si128(data), ~whitespace & 0xFFFF
+					, output + written);
+			written += compact(_mm256_extracti128_si256(data, 1), ~whitespace >> 16
+					, output + written);
+		}
+	}
+	return position;
+}
+
+BASECODER_TARGET("avx512f,avx512bw,avx512vbmi2")
+inline std::size_t stripWhitespaceAvx512Vbmi2(const char *input, std::size_t size
+		, char *output, std::size_t &written)
+{
+	const __m512i space = _mm512_set1_epi8(' ');
+	const __m512i tab = _mm512_set1_epi8('\t');
+	const __m512i four = _mm512_set1_epi8(4);
+
+	std::size_t position = 0;
+	for (; size - position >= 64; position += 64)
+	{
+		const __m512i data = _mm512_loadu_si512(input + position);
+		const __mmask64 keep = ~(_mm512_cmpeq_epi8_mask(data, space)
+				| _mm512_cmple_epu8_mask(_mm512_sub_epi8(data, tab), four));
+		_mm512_storeu_si512(output + written, _mm512_maskz_compress_epi8(keep, data));
+		written += static_cast<std::size_t>(__builtin_popcountll(keep));
+	}
+	return position;
+}
+
+// Base16
+
+///
+/// \brief base16Values: arithmetic decoding of hex digits of any case
+/// \param input
+/// \param values indices of characters, valid if result is zero
+/// \return mask of characters which aren't hex digits
+///
+BASECODER_TARGET("ssse3")
+inline __m128i base16Values(__m128i input, __m128i &values)
+{
+	const __m128i digit = inRange(input, '0', '9');
+	const __m128i lowered = _mm_or_si128(input, _mm_set1_epi8(0x20));
+	const __m128i letter = inRange(lowered, 'a', 'f');
+	values = _mm_or_si128(
+			_mm_and_si128(digit, _mm_sub_epi8(input, _mm_set1_epi8('0')))
+			, _mm_and_si128(letter, _mm_sub_epi8(lowered, _mm_set1_epi8('a' - 10))));
+	return _mm_cmpeq_epi8(_mm_or_si128(digit, letter), _mm_setzero_si128());
+}
+
+///
+/// \brief base16DecodeLookup
+/// \param input
+/// \param values indices of characters, valid if high bits of result are clear
+/// \return mask of characters outside of alphabet, only high bits are meaningful
+///
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+inline __m128i base16DecodeLookup(__m128i input, __m128i &values)
+{
+	if constexpr (!isBase16Layout<Trait>())
+	{
+		values = tableDecodeLookup<Trait>(input);
+		return values;
+	}
+
+	return base16Values(input, values);
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+std::size_t base16EncodeSsse3(const std::uint8_t *input, std::size_t size, char *output)
+{
+	const __m128i lookup = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Trait::alphabet));
+	const __m128i nibble = _mm_set1_epi8(0x0F);
+
+	std::size_t position = 0;
+	for (; size - position >= 16; position += 16, output += 32)
+	{
+		const __m128i data = _mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(input + position));
+		const __m128i high = _mm_and_si128(_mm_srli_epi16(data, 4), nibble);
+		const __m128i low = _mm_and_si128(data, nibble);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output)
+				, _mm_shuffle_epi8(lookup, _mm_unpacklo_epi8(high, low)));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output + 16)
+				, _mm_shuffle_epi8(lookup, _mm_unpackhi_epi8(high, low)));
+	}
+	return position;
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+std::size_t base16DecodeSsse3(const char *input, std::size_t size, std::uint8_t *output)
+{
+	// high nibble * 16 + low nibble
+	const __m128i weights = _mm_set1_epi16(0x0110);
+
+	std::size_t position = 0;
+	for (; size - position >= 32; position += 32, output += 16)
+	{
+		const auto *data = reinterpret_cast<const __m128i *>(input + position);
+		__m128i first;
+		__m128i second;
+		if (_mm_movemask_epi8(_mm_or_si128(
+				base16DecodeLookup<Trait>(_mm_loadu_si128(data), first)
+				, base16DecodeLookup<Trait>(_mm_loadu_si128(data + 1), second))))
+		{
+			break;
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm_packus_epi16(
+				_mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights)));
+	}
+	return position;
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+std::size_t base16ValidateSsse3(const char *input, std::size_t size)
+{
+	std::size_t position = 0;
+	for (; size - position >= 16; position += 16)
+	{
+		__m128i values;
+		if (_mm_movemask_epi8(base16DecodeLookup<Trait>(_mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(input + position)), values)))
+		{
+			break;
+		}
+	}
+	return position;
+}
+
+BASECODER_TARGET("avx2")
+inline __m256i base16Values(__m256i input, __m256i &values)
+{
+	const __m256i digit = inRange(input, '0', '9');
+	const __m256i lowered = _mm256_or_si256(input, _mm256_set1_epi8(0x20));
+	const __m256i letter = inRange(lowered, 'a', 'f');
+	values = _mm256_or_si256(
+			_mm256_and_si256(digit, _mm256_sub_epi8(input, _mm256_set1_epi8('0')))
+			, _mm256_and_si256(letter, _mm256_sub_epi8(lowered, _mm256_set1_epi8('a' - 10))));
+	return _mm256_cmpeq_epi8(_mm256_or_si256(digit, letter), _mm256_setzero_si256());
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+inline __m256i base16DecodeLookup(__m256i input, __m256i &values)
+{
+	if constexpr (!isBase16Layout<Trait>())
+	{
+		values = tableDecodeLookup<Trait>(input);
+		return values;
+	}
+
+	return base16Values(input, values);
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+std::size_t base16EncodeAvx2(const std::uint8_t *input, std::size_t size, char *output)
+{
+	const __m256i lookup = _mm256_broadcastsi128_si256(
+			_mm_loadu_si128(reinterpret_cast<const __m128i *>(Trait::alphabet)));
+	const __m256i nibble = _mm256_set1_epi16(0x0F);
+
+	std::size_t position = 0;
+	for (; size - position >= 16; position += 16, output += 32)
+	{
+		// every byte is widened to 16 bits: high nibble to the first byte,
+		// low nibble to the second one
+		const __m256i data = _mm256_cvtepu8_epi16(_mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(input + position)));
+		const __m256i nibbles = _mm256_or_si256(_mm256_srli_epi16(data, 4)
+				, _mm256_slli_epi16(_mm256_and_si256(data, nibble), 8));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output)
+				, _mm256_shuffle_epi8(lookup, nibbles));
+	}
+	return position;
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+std::size_t base16DecodeAvx2(const char *input, std::size_t size, std::uint8_t *output)
+{
+	const __m256i weights = _mm256_set1_epi16(0x0110);
+
+	std::size_t position = 0;
+	for (; size - position >= 64; position += 64, output += 32)
+	{
+		const auto *data = reinterpret_cast<const __m256i *>(input + position);
+		__m256i first;
+		__m256i second;
+		if (_mm256_movemask_epi8(_mm256_or_si256(
+				base16DecodeLookup<Trait>(_mm256_loadu_si256(data), first)
+				, base16DecodeLookup<Trait>(_mm256_loadu_si256(data + 1), second))))
+		{
+			break;
+		}
+		// packing works in lanes, quadwords are reordered back
+		const __m256i packed = _mm256_packus_epi16(_mm256_maddubs_epi16(first, weights)
+				, _mm256_maddubs_epi16(second, weights));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output)
+				, _mm256_permute4x64_epi64(packed, 0xD8));
+	}
+	return position + base16DecodeSsse3<Trait>(input + position, size - position, output);
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+std::size_t base16ValidateAvx2(const char *input, std::size_t size)
+{
+	std::size_t position = 0;
+	for (; size - position >= 32; position += 32)
+	{
+		__m256i values;
+		if (_mm256_movemask_epi8(base16DecodeLookup<Trait>(_mm256_loadu_si256(
+				reinterpret_cast<const __m256i *>(input + position)), values)))
+		{
+			break;
+		}
+	}
+	return position + base16ValidateSsse3<Trait>(input + position, size - position);
+}
+
+BASECODER_TARGET("avx512f,avx512bw")
+inline __mmask64 base16Values(__m512i input, __m512i &values)
+{
+	const __mmask64 digit = inRange(input, '0', '9');
+	const __m512i lowered = _mm512_or_si512(input, _mm512_set1_epi8(0x20));
+	const __mmask64 letter = inRange(lowered, 'a', 'f');
+	values = _mm512_mask_sub_epi8(_mm512_sub_epi8(lowered, _mm512_set1_epi8('a' - 10))
+			, digit, input, _mm512_set1_epi8('0'));
+	return ~(digit | letter);
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx512f,avx512bw")
+std::size_t base16EncodeAvx512(const std::uint8_t *input, std::size_t size, char *output)
+{
+	const __m512i lookup = _mm512_maskz_broadcast_i32x4(0xFFFF
+			, _mm_loadu_si128(reinterpret_cast<const __m128i *>(Trait::alphabet)));
+	const __m512i nibble = _mm512_set1_epi16(0x0F);
+
+	std::size_t position = 0;
+	for (; size - position >= 32; position += 32, output += 64)
+	{
+		const __m512i data = _mm512_cvtepu8_epi16(_mm256_loadu_si256(
+				reinterpret_cast<const __m256i *>(input + position)));
+		const __m512i nibbles = _mm512_or_si512(_mm512_srli_epi16(data, 4)
+				, _mm512_slli_epi16(_mm512_and_si512(data, nibble), 8));
+		_mm512_storeu_si512(output, _mm512_shuffle_epi8(lookup, nibbles));
+	}
+	return position;
+}
+
+BASECODER_TARGET("avx512f,avx512bw")
+inline std::size_t base16DecodeAvx512(const char *input, std::size_t size
+		, std::uint8_t *output)
+{
+	const __m512i weights = _mm512_set1_epi16(0x0110);
+
+	std::size_t position = 0;
+	for (; size - position >= 64; position += 64, output += 32)
+	{
+		__m512i values;
+		if (base16Values(_mm512_loadu_si512(input + position), values))
+		{
+			break;
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output)
+				, _mm512_maskz_cvtepi16_epi8(~0u, _mm512_maddubs_epi16(values, weights)));
+	}
+	return position;
+}
+
+BASECODER_TARGET("avx512f,avx512bw")
+inline std::size_t base16ValidateAvx512(const char *input, std::size_t size)
+{
+	std::size_t position = 0;
+	for (; size - position >= 64; position += 64)
+	{
+		__m512i values;
+		if (base16Values(_mm512_loadu_si512(input + position), values))
+		{
+			break;
+		}
+	}
+	return position;
+}
+
+// alphabet remapping of formats of the same type
+
+template<typename FromTrait, typename ToTrait>
+BASECODER_TARGET("ssse3")
+inline bool remapLookup(__m128i input, __m128i &output)
+{
+	if constexpr (FromTrait::type == Type::Base64)
+	{
+		// layouts differ only in the last two characters
+		if (_mm_movemask_epi8(base64Invalid<FromTrait>(input)))
+		{
+			return false;
+		}
+		const __m128i is62 = _mm_cmpeq_epi8(input, _mm_set1_epi8(char62<FromTrait>));
+		const __m128i is63 = _mm_cmpeq_epi8(input, _mm_set1_epi8(char63<FromTrait>));
+		output = _mm_xor_si128(input, _mm_or_si128(
+				_mm_and_si128(is62, _mm_set1_epi8(char62<FromTrait> ^ char62<ToTrait>))
+				, _mm_and_si128(is63, _mm_set1_epi8(char63<FromTrait> ^ char63<ToTrait>))));
+	}
+	else if constexpr (FromTrait::type == Type::Base32)
+	{
+		__m128i indices;
+		if (_mm_movemask_epi8(base32DecodeLookup<FromTrait>(input, indices)))
+		{
+			return false;
+		}
+		output = base32EncodeLookup<ToTrait>(indices);
+	}
+	else
+	{
+		__m128i indices;
+		if (_mm_movemask_epi8(base16Values(input, indices)))
+		{
+			return false;
+		}
+		output = _mm_shuffle_epi8(_mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(ToTrait::alphabet)), indices);
+	}
+	return true;
+}
+
+template<typename FromTrait, typename ToTrait>
+BASECODER_TARGET("ssse3")
+std::size_t remapSsse3(const char *input, std::size_t size, char *output)
+{
+	std::size_t position = 0;
+	for (; size - position >= 16; position += 16)
+	{
+		__m128i result;
+		if (!remapLookup<FromTrait, ToTrait>(_mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(input + position)), result))
+		{
+			break;
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output + position), result);
+	}
+	return position;
+}
+
+template<typename FromTrait, typename ToTrait>
+BASECODER_TARGET("avx2")
+inline bool remapLookup(__m256i input, __m256i &output)
+{
+	if constexpr (FromTrait::type == Type::Base64)
+	{
+		if (_mm256_movemask_epi8(base64Invalid<FromTrait>(input)))
+		{
+			return false;
+		}
+		const __m256i is62 = _mm256_cmpeq_epi8(input, _mm256_set1_epi8(char62<FromTrait>));
+		const __m256i is63 = _mm256_cmpeq_epi8(input, _mm256_set1_epi8(char63<FromTrait>));
+		output = _mm256_xor_si256(input, _mm256_or_si256(
+				_mm256_and_si256(is62, _mm256_set1_epi8(char62<FromTrait> ^ char62<ToTrait>))
+				, _mm256_and_si256(is63
+						, _mm256_set1_epi8(char63<FromTrait> ^ char63<ToTrait>))));
+	}
+	else if constexpr (FromTrait::type == Type::Base32)
+	{
+		__m256i indices;
+		if (_mm256_movemask_epi8(base32DecodeLookup<FromTrait>(input, indices)))
+		{
+			return false;
+		}
+		output = base32EncodeLookup<ToTrait>(indices);
+	}
+	else
+	{
+		__m256i indices;
+		if (_mm256_movemask_epi8(base16Values(input, indices)))
+		{
+			return false;
+		}
+		output = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(
+				reinterpret_cast<const __m128i *>(ToTrait::alphabet))), indices);
+	}
+	return true;
+}
+
+template<typename FromTrait, typename ToTrait>
+BASECODER_TARGET("avx2")
+std::size_t remapAvx2(const char *input, std::size_t size, char *output)
+{
+	std::size_t position = 0;
+	for (; size - position >= 32; position += 32)
+	{
+		__m256i result;
+		if (!remapLookup<FromTrait, ToTrait>(_mm256_loadu_si256(
+				reinterpret_cast<const __m256i *>(input + position)), result))
+		{
+			break;
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + position), result);
+	}
+	return position + remapSsse3<FromTrait, ToTrait>(input + position, size - position
+			, output + position);
+}
+
+// Base85 groups of 5 characters
+
+///
+/// \brief base85DecodeLookup: characters -> digits
+/// \param input
+/// \return digits of characters, high bit is set for invalid characters
+///
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+inline __m128i base85DecodeLookup(__m128i input)
+{
+	if constexpr (isConsecutiveAlphabet<Trait>())
+	{
+		// digits above 84 and wrapped ones are invalid, compared as unsigned
+		const __m128i digits = _mm_sub_epi8(input, _mm_set1_epi8(Trait::alphabet[0]));
+		const __m128i invalid = _mm_cmpgt_epi8(
+				_mm_xor_si128(digits, _mm_set1_epi8(static_cast<char>(0x80)))
+				, _mm_set1_epi8(static_cast<char>((Trait::alphabetSize - 1) ^ 0x80)));
+		return _mm_or_si128(digits, invalid);
+	}
+	else
+	{
+		return tableDecodeLookup<Trait>(input);
+	}
+}
+
+///
+/// \brief base85DecodeGroups: 4 groups -> 4 big-endian 32-bit values
+/// \param first characters 0..15
+/// \param second characters 4..19
+/// \param values
+/// \return false for invalid character or group above 2^32 - 1
+///
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+inline bool base85DecodeGroups(__m128i first, __m128i second, __m128i &values)
+{
+	const __m128i firstDigits = base85DecodeLookup<Trait>(first);
+	const __m128i secondDigits = base85DecodeLookup<Trait>(second);
+
+	// the leading 4 digits of every group in 32-bit lanes and the last one apart
+	const __m128i leading = _mm_or_si128(
+			_mm_shuffle_epi8(firstDigits, _mm_setr_epi8(0, 1, 2, 3, 5, 6, 7, 8
+					, 10, 11, 12, 13, -1, -1, -1, -1))
+			, _mm_shuffle_epi8(secondDigits, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1
+					, -1, -1, -1, -1, 11, 12, 13, 14)));
+	const __m128i last = _mm_or_si128(
+			_mm_shuffle_epi8(firstDigits, _mm_setr_epi8(4, -1, -1, -1, 9, -1, -1, -1
+					, 14, -1, -1, -1, -1, -1, -1, -1))
+			, _mm_shuffle_epi8(secondDigits, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1
+					, -1, -1, -1, -1, 15, -1, -1, -1)));
+
+	// d0 * 85^3 + d1 * 85^2 + d2 * 85 + d3 by pairs, at most 85^4 - 1
+	const __m128i pairs = _mm_maddubs_epi16(leading, _mm_set1_epi16(85 | (1 << 8)));
+	const __m128i high = _mm_madd_epi16(pairs, _mm_set1_epi32(85 * 85 | (1 << 16)));
+
+	// high * 85 + d4 doesn't fit 32 bits, 2^32 - 1 is multiple of 85
+	const __m128i limit = _mm_set1_epi32(0xFFFFFFFFu / 85);
+	const __m128i overflow = _mm_or_si128(_mm_cmpgt_epi32(high, limit)
+			, _mm_andnot_si128(_mm_cmpeq_epi32(last, _mm_setzero_si128())
+					, _mm_cmpeq_epi32(high, limit)));
+	if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(firstDigits, secondDigits), overflow)))
+	{
+		return false;
+	}
+
+	// 85 = 64 + 16 + 4 + 1, SSSE3 has no 32-bit multiplication
+	const __m128i value = _mm_add_epi32(
+			_mm_add_epi32(_mm_slli_epi32(high, 6), _mm_slli_epi32(high, 4))
+			, _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(high, 2), high), last));
+	values = _mm_shuffle_epi8(value, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4
+			, 11, 10, 9, 8, 15, 14, 13, 12));
+	return true;
+}
+
+template<typename Trait>
+BASECODER_TARGET("ssse3")
+std::size_t base85DecodeSsse3(const char *input, std::size_t size, std::uint8_t *output)
+{
+	std::size_t position = 0;
+	for (; size - position >= 20; position += 20)
+	{
+		__m128i values;
+		if (!base85DecodeGroups<Trait>(
+				_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + position))
+				, _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + position + 4))
+				, values))
+		{
+			break;
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(output + position / 5 * 4), values);
+	}
+	return position;
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+inline __m256i base85DecodeLookup(__m256i input)
+{
+	if constexpr (isConsecutiveAlphabet<Trait>())
+	{
+		const __m256i digits = _mm256_sub_epi8(input, _mm256_set1_epi8(Trait::alphabet[0]));
+		const __m256i invalid = _mm256_cmpgt_epi8(
+				_mm256_xor_si256(digits, _mm256_set1_epi8(static_cast<char>(0x80)))
+				, _mm256_set1_epi8(static_cast<char>((Trait::alphabetSize - 1) ^ 0x80)));
+		return _mm256_or_si256(digits, invalid);
+	}
+	else
+	{
+		return tableDecodeLookup<Trait>(input);
+	}
+}
+
+///
+/// \brief base85DecodeGroups: 8 groups, 4 of them in every 128-bit lane
+///
+template<typename Trait>
+BASECODER_TARGET("avx2")
+inline bool base85DecodeGroups(__m256i first, __m256i second, __m256i &values)
+{
+	const __m256i firstDigits = base85DecodeLookup<Trait>(first);
+	const __m256i secondDigits = base85DecodeLookup<Trait>(second);
+
+	const __m256i leading = _mm256_or_si256(
+			_mm256_shuffle_epi8(firstDigits, _mm256_broadcastsi128_si256(_mm_setr_epi8(
+					0, 1, 2, 3, 5, 6, 7, 8, 10, 11, 12, 13, -1, -1, -1, -1)))
+			, _mm256_shuffle_epi8(secondDigits, _mm256_broadcastsi128_si256(_mm_setr_epi8(
+					-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 11, 12, 13, 14))));
+	const __m256i last = _mm256_or_si256(
+			_mm256_shuffle_epi8(firstDigits, _mm256_broadcastsi128_si256(_mm_setr_epi8(
+					4, -1, -1, -1, 9, -1, -1, -1, 14, -1, -1, -1, -1, -1, -1, -1)))
+			, _mm256_shuffle_epi8(secondDigits, _mm256_broadcastsi128_si256(_mm_setr_epi8(
+					-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 15, -1, -1, -1))));
+
+	const __m256i pairs = _mm256_maddubs_epi16(leading, _mm256_set1_epi16(85 | (1 << 8)));
+	const __m256i high = _mm256_madd_epi16(pairs, _mm256_set1_epi32(85 * 85 | (1 << 16)));
+
+	const __m256i limit = _mm256_set1_epi32(0xFFFFFFFFu / 85);
+	const __m256i overflow = _mm256_or_si256(_mm256_cmpgt_epi32(high, limit)
+			, _mm256_andnot_si256(_mm256_cmpeq_epi32(last, _mm256_setzero_si256())
+					, _mm256_cmpeq_epi32(high, limit)));
+	if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(firstDigits, secondDigits)
+			, overflow)))
+	{
+		return false;
+	}
+
+	const __m256i value = _mm256_add_epi32(_mm256_mullo_epi32(high, _mm256_set1_epi32(85))
+			, last);
+	values = _mm256_shuffle_epi8(value, _mm256_broadcastsi128_si256(_mm_setr_epi8(
+			3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)));
+	return true;
+}
+
+///
+/// \brief base85Load: 16 characters of 4 groups to every 128-bit lane
+/// \param input at least 36 readable characters
+///
+BASECODER_TARGET("avx2")
+inline __m256i base85Load(const char *input)
+{
+	return _mm256_inserti128_si256(_mm256_castsi128_si256(
+			_mm_loadu_si128(reinterpret_cast<const __m128i *>(input)))
+			, _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + 20)), 1);
+}
+
+template<typename Trait>
+BASECODER_TARGET("avx2")
+std::size_t base85DecodeAvx2(const char *input, std::size_t size, std::uint8_t *output)
+{
+	std::size_t position = 0;
+	for (; size - position >= 40; position += 40)
+	{
+		__m256i values;
+		if (!base85DecodeGroups<Trait>(base85Load(input + position)
+				, base85Load(input + position + 4), values))
+		{
+			break;
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + position / 5 * 4), values);
+	}
+	return position + base85DecodeSsse3<Trait>(input + position, size - position
+			, output + position / 5 * 4);
+}
+
+} // namespace detail
+
+#endif // BASECODER_SIMD
+
+///
+/// \brief The Kernels struct: vectorized processing of whole blocks
+/// \tparam Trait
+///
+template<typename Trait, typename = void>
+struct Kernels
+{
+	///
+	/// \brief encode
+	/// \return count of consumed input bytes, multiple of Trait::inputBufferSize
+	///
+	static std::size_t encode(SimdLevel, const std::uint8_t *, std::size_t, char *)
+	{
+		return 0;
+	}
+
+	///
+	/// \brief decode
+	/// \return count of consumed input characters, multiple of Trait::indexBufferSize
+	///
+	static std::size_t decode(SimdLevel, const char *, std::size_t, std::uint8_t *)
+	{
+		return 0;
+	}
+
+	///
+	/// \brief validate
+	/// \return count of leading input characters checked to be in alphabet
+	///
+	static std::size_t validate(SimdLevel, const char *, std::size_t)
+	{
+		return 0;
+	}
+};
+
+///
+/// \brief The Kernels struct for Base64 alphabets: characters are mapped by ranges
+/// for "A-Za-z0-9" layout and by table lookup for other ASCII alphabets
+/// \tparam Trait
+///
+template<typename Trait>
+struct Kernels<Trait, std::enable_if_t<Trait::type == Type::Base64
+		&& isAsciiAlphabet<Trait>()>>
+{
+	///
+	/// \brief encode
+	/// \param level
+	/// \param input
+	/// \param size count of input bytes
+	/// \param output buffer for size / 3 * 4 characters
+	/// \return count of consumed input bytes, multiple of 3
+	///
+	static std::size_t encode(SimdLevel level, const std::uint8_t *input, std::size_t size
+			, char *output)
+	{
+#if BASECODER_SIMD
+		switch (level)
+		{
+			case SimdLevel::Avx512Vbmi:
+			{
+				const std::size_t position = detail::base64EncodeAvx512Vbmi<Trait>(
+						input, size, output);
+				return position + detail::base64EncodeAvx2<Trait>(input + position
+						, size - position, output + position / 3 * 4);
+			}
+			case SimdLevel::Avx512:
+				if constexpr (isBase64Layout<Trait>())
+				{
+					const std::size_t position = detail::base64EncodeAvx512<Trait>(
+							input, size, output);
+					return position + detail::base64EncodeAvx2<Trait>(input + position
+							, size - position, output + position / 3 * 4);
+				}
+				else
+				{
+					return detail::base64EncodeAvx2<Trait>(input, size, output);
+				}
+			case SimdLevel::Avx2:
+				return detail::base64EncodeAvx2<Trait>(input, size, output);
+			case SimdLevel::Ssse3:
+				return detail::base64EncodeSsse3<Trait>(input, size, output);
+			case SimdLevel::Scalar:
+				break;
+		}
+#else
+		(void)level;
+		(void)input;
+		(void)size;
+		(void)output;
+#endif
+		return 0;
+	}
+
+	///
+	/// \brief decode
+	/// \param level
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for size / 4 * 3 bytes
+	/// \return count of consumed input characters, multiple of 4;
+	/// processing stops before vector with pad or invalid character
+	///
+	static std::size_t decode(SimdLevel level, const char *input, std::size_t size
+			, std::uint8_t *output)
+	{
+#if BASECODER_SIMD
+		switch (level)
+		{
+			case SimdLevel::Avx512Vbmi:
+			{
+				const std::size_t position = detail::base64DecodeAvx512Vbmi<Trait>(
+						input, size, output);
+				return position + detail::base64DecodeAvx2<Trait>(input + position
+						, size - position, output + position / 4 * 3);
+			}
+			case SimdLevel::Avx512:
+				if constexpr (isBase64Layout<Trait>())
+				{
+					const std::size_t position = detail::base64DecodeAvx512<Trait>(
+							input, size, output);
+					return position + detail::base64DecodeAvx2<Trait>(input + position
+							, size - position, output + position / 4 * 3);
+				}
+				else
+				{
+					return detail::base64DecodeAvx2<Trait>(input, size, output);
+				}
+			case SimdLevel::Avx2:
+				return detail::base64DecodeAvx2<Trait>(input, size, output);
+			case SimdLevel::Ssse3:
+				return detail::base64DecodeSsse3<Trait>(input, size, output);
+			case SimdLevel::Scalar:
+				break;
+		}
+#else
+		(void)level;
+		(void)input;
+		(void)size;
+		(void)output;
+#endif
+		return 0;
+	}
+
+	///
+	/// \brief validate
+	/// \param level
+	/// \param input
+	/// \param size count of input characters
+	/// \return count of leading input characters checked to be in alphabet,
+	/// multiple of 16; checking stops before vector with pad or invalid character
+	///
+	static std::size_t validate(SimdLevel level, const char *input, std::size_t size)
+	{
+#if BASECODER_SIMD
+		switch (level)
+		{
+			case SimdLevel::Avx512Vbmi:
+			{
+				const std::size_t position = detail::base64ValidateAvx512Vbmi<Trait>(
+						input, size);
+				return position + detail::base64ValidateAvx2<Trait>(input + position
+						, size - position);
+			}
+			case SimdLevel::Avx512:
+				if constexpr (isBase64Layout<Trait>())
+				{
+					const std::size_t position = detail::base64ValidateAvx512<Trait>(
+							input, size);
+					return position + detail::base64ValidateAvx2<Trait>(input + position
+							, size - position);
+				}
+				else
+				{
+					return detail::base64ValidateAvx2<Trait>(input, size);
+				}
+			case SimdLevel::Avx2:
+				return detail::base64ValidateAvx2<Trait>(input, size);
+			case SimdLevel::Ssse3:
+				return detail::base64ValidateSsse3<Trait>(input, size);
+			case SimdLevel::Scalar:
+				break;
+		}
+#else
+		(void)level;
+		(void)input;
+		(void)size;
+#endif
+		return 0;
+	}
+};
+
+///
+/// \brief The Kernels struct for Base16 alphabets: nibbles are mapped to characters
+/// by pshufb, characters are decoded by range checks for hex digits of any case
+/// and by table lookup for other ASCII alphabets
+/// \tparam Trait
+///
+template<typename Trait>
+struct Kernels<Trait, std::enable_if_t<Trait::type == Type::Base16
+		&& isAsciiAlphabet<Trait>()>>
+{
+	///
+	/// \brief encode
+	/// \param level
+	/// \param input
+	/// \param size count of input bytes
+	/// \param output buffer for size * 2 characters
+	/// \return count of consumed input bytes
+	///
+	static std::size_t encode(SimdLevel level, const std::uint8_t *input, std::size_t size
+			, char *output)
+	{
+#if BASECODER_SIMD
+		switch (level)
+		{
+			case SimdLevel::Avx512Vbmi:
+			case SimdLevel::Avx512:
+			{
+				const std::size_t position = detail::base16EncodeAvx512<Trait>(
+						input, size, output);
+				return position + detail::base16EncodeAvx2<Trait>(input + position
+						, size - position, output + position * 2);
+			}
+			case SimdLevel::Avx2:
+				return detail::base16EncodeAvx2<Trait>(input, size, output);
+			case SimdLevel::Ssse3:
+				return detail::base16EncodeSsse3<Trait>(input, size, output);
+			case SimdLevel::Scalar:
+				break;
+		}
+#else
+		(void)level;
+		(void)input;
+		(void)size;
+		(void)output;
+#endif
+		return 0;
+	}
+
+	///
+	/// \brief decode: digits of both cases are accepted
+	/// \param level
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for size / 2 bytes
+	/// \return count of consumed input characters, multiple of 32;
+	/// processing stops before vector with invalid character
+	///
+	static std::size_t decode(SimdLevel level, const char *input, std::size_t size
+			, std::uint8_t *output)
+	{
+#if BASECODER_SIMD
+		switch (level)
+		{
+			case SimdLevel::Avx512Vbmi:
+			case SimdLevel::Avx512:
+				if constexpr (isBase16Layout<Trait>())
+				{
+					const std::size_t position = detail::base16DecodeAvx512(
+							input, size, output);
+					return position + detail::base16DecodeAvx2<Trait>(input + position
+							, size - position, output + position / 2);
+				}
+				else
+				{
+					return detail::base16DecodeAvx2<Trait>(input, size, output);
+				}
+			case SimdLevel::Avx2:
+				return detail::base16DecodeAvx2<Trait>(input, size, output);
+			case SimdLevel::Ssse3:
+				return detail::base16DecodeSsse3<Trait>(input, size, output);
+			case SimdLevel::Scalar:
+				break;
+		}
+#else
+		(void)level;
+		(void)input;
+		(void)size;
+		(void)output;
+#endif
+		return 0;
+	}
+
+	///
+	/// \brief validate
+	/// \param level
+	/// \param input
+	/// \param size count of input characters
+	/// \return count of leading input characters checked to be hex digits,
+	/// multiple of 16; checking stops before vector with invalid character
+	///
+	static std::size_t validate(SimdLevel level, const char *input, std::size_t size)
+	{
+#if BASECODER_SIMD
+		switch (level)
+		{
+			case SimdLevel::Avx512Vbmi:
+			case SimdLevel::Avx512:
+				if constexpr (isBase16Layout<Trait>())
+				{
+					const std::size_t position = detail::base16ValidateAvx512(input, size);
+					return position + detail::base16ValidateAvx2<Trait>(input + position
+							, size - position);
+				}
+				else
+				{
+					return detail::base16ValidateAvx2<Trait>(input, size);
+				}
+			case SimdLevel::Avx2:
+				return detail::base16ValidateAvx2<Trait>(input, size);
+			case SimdLevel::Ssse3:
+				return detail::base16ValidateSsse3<Trait>(input, size);
+			case SimdLevel::Scalar:
+				break;
+		}
+#else
+		(void)level;
+		(void)input;
+		(void)size;
+#endif
+		return 0;
+	}
+};
+
+///
+/// \brief The Kernels struct for Base32 alphabets: 5-byte groups are split to
+/// indices by shifts in 16-bit words, characters are mapped by pshufb and decoded
+/// by ranges for two runs of consecutive characters, by table lookup otherwise
+/// \tparam Trait
+///
+template<typename Trait>
+struct Kernels<Trait, std::enable_if_t<Trait::type == Type::Base32
+		&& isAsciiAlphabet<Trait>()>>
+{
+	///
+	/// \brief encode
+	/// \param level
+	/// \param input
+	/// \param size count of input bytes
+	/// \param output buffer for size / 5 * 8 characters
+	/// \return count of consumed input bytes, multiple of 5
+	///
+	static std::size_t encode(SimdLevel level, const std::uint8_t *input, std::size_t size
+			, char *output)
+	{
+#if BASECODER_SIMD
+		switch (level)
+		{
+			case SimdLevel::Avx512Vbmi:
+			{
+				const std::size_t position = detail::base32EncodeAvx512Vbmi<Trait>(
+						input, size, output);
+				return position + detail::base32EncodeAvx2<Trait>(input + position
+						, size - position, output + position / 5 * 8);
+			}
+			case SimdLevel::Avx512:
+			case SimdLevel::Avx2:
+				return detail::base32EncodeAvx2<Trait>(input, size, output);
+			case SimdLevel::Ssse3:
+				return detail::base32EncodeSsse3<Trait>(input, size, output);
+			case SimdLevel::Scalar:
+				break;
+		}
+#else
+		(void)level;
+		(void)input;
+		(void)size;
+		(void)output;
+#endif
+		return 0;
+	}
+
+	///
+	/// \brief decode
+	/// \param level
+	/// \param input
+	/// \param size count of input characters
+	/// \param output buffer for size / 8 * 5 bytes
+	/// \return count of consumed input characters, multiple of 16;
+	/// processing stops before vector with pad or invalid character
+	///
+	static std::size_t decode(SimdLevel level, const char *input, std::size_t size
+			, std::uint8_t *output)
+	{
+#if BASECODER_SIMD
+		switch (level)
+		{
+			case SimdLevel::Avx512Vbmi:
+			{
+				const std::size_t position = detail::base32DecodeAvx512Vbmi<Trait>(
+						input, size, output);
+				return position + detail::base32DecodeAvx2<Trait>(input + position
+						, size - position, output + position / 8 * 5);
+			}
+			case SimdLevel::Avx512:
+			case SimdLevel::Avx2:
+				return detail::base32DecodeAvx2<Trait>(input, size, output);
+			case SimdLevel::Ssse3:
+				return detail::base32DecodeSsse3<Trait>(input, size, output);
+			case SimdLevel::Scalar:
+				break;
+		}
+#else
+		(void)level;
+		(void)input;
+		(void)size;
+		(void)output;
+#endif
+		return 0;
+	}
+
+	///
+	/// \brief validate
+	/// \param level
+	/// \param input
+	/// \param size count of input characters
+	/// \return count of leading input characters checked to be in alphabet,
+	/// multiple of 16; checking stops before vector with pad or invalid character
+	///
+	static std::size_t validate(SimdLevel level, const char *input, std::size_t size)
+	{
+#if BASECODER_SIMD
+		switch (level)
+		{
+			case SimdLevel::Avx512Vbmi:
+			{
+				// table lookup of Base64 kernel doesn't depend on alphabet
+				const std::size_t position = detail::base64ValidateAvx512Vbmi<Trait>(
+						input, size);
+				return position + detail::base32ValidateAvx2<Trait>(input + position
+						, size - position);
+			}
+			case SimdLevel::Avx512:
+			case SimdLevel::Avx2:
+				return detail::base32ValidateAvx2<Trait>(input, size);
+			case SimdLevel::Ssse3:
+				return detail::base32ValidateSsse3<Trait>(input, size);
+			case SimdLevel::Scalar:
+				break;
+		}
+#else
+		(void)level;
+		(void)input;
+		(void)size;
+#endif
+		return 0;
+	}
+};
+
+///
+/// \brief hasRemap
+/// \return true if characters of FromTrait may be remapped to characters of
+/// ToTrait with the same index by vector kernels
+///
+template<typename FromTrait, typename ToTrait>
+constexpr bool hasRemap()
+{
+	return (isBase64Layout<FromTrait>() && isBase64Layout<ToTrait>())
+			|| (isBase32Layout<FromTrait>() && isBase32Layout<ToTrait>())
+			|| (isBase16Layout<FromTrait>() && isBase16Layout<ToTrait>());
+}
+
+///
+/// \brief remap: replace characters of FromTrait by characters of ToTrait
+/// with the same index
+/// \param level
+/// \param input
+/// \param size count of input characters
+/// \param output buffer for size characters
+/// \return count of consumed input characters, processing stops before vector
+/// with pad or invalid character
+///
+template<typename FromTrait, typename ToTrait>
+std::size_t remap(SimdLevel level, const char *input, std::size_t size, char *output)
+{
+#if BASECODER_SIMD
+	if constexpr (hasRemap<FromTrait, ToTrait>())
+	{
+		switch (level)
+		{
+			case SimdLevel::Avx512Vbmi:
+			case SimdLevel::Avx512:
+			case SimdLevel::Avx2:
+				return detail::remapAvx2<FromTrait, ToTrait>(input, size, output);
+			case SimdLevel::Ssse3:
+				return detail::remapSsse3<FromTrait, ToTrait>(input, size, output);
+			case SimdLevel::Scalar:
+				break;
+		}
+	}
+#endif
+	(void)level;
+	(void)input;
+	(void)size;
+	(void)output;
+	return 0;
+}
+
+///
+/// \brief base85Decode: groups of 5 characters -> big-endian 32-bit values
+/// \tparam Trait alphabet of 85 ASCII characters with reverseAlphabet
+/// \param level
+/// \param input
+/// \param size count of input characters
+/// \param output buffer for size / 5 * 4 bytes
+/// \return count of consumed input characters, multiple of 5, processing stops
+/// before vector with invalid character or group above 2^32 - 1
+///
+template<typename Trait>
+std::size_t base85Decode(SimdLevel level, const char *input, std::size_t size
+		, std::uint8_t *output)
+{
+#if BASECODER_SIMD
+	if constexpr (Trait::alphabetSize == 85 && isAsciiAlphabet<Trait>())
+	{
+		switch (level)
+		{
+			case SimdLevel::Avx512Vbmi:
+			case SimdLevel::Avx512:
+			case SimdLevel::Avx2:
+				return detail::base85DecodeAvx2<Trait>(input, size, output);
+			case SimdLevel::Ssse3:
+				return detail::base85DecodeSsse3<Trait>(input, size, output);
+			case SimdLevel::Scalar:
+				break;
+		}
+	}
+#endif
+	(void)level;
+	(void)input;
+	(void)size;
+	(void)output;
+	return 0;
+}
+
+///
+/// \brief stripWhitespace: copy characters except ASCII whitespace
+/// \param level
+/// \param input
+/// \param size count of input characters
+/// \param output buffer for size characters, may be written past the kept ones
+/// \param written count of kept characters, increased by count of copied ones
+/// \return count of consumed input characters, processing stops before
+/// the last incomplete vector
+///
+inline std::size_t stripWhitespace(SimdLevel level, const char *input, std::size_t size
+		, char *output, std::size_t &written)
+{
+#if BASECODER_SIMD
+	switch (level)
+	{
+		case SimdLevel::Avx512Vbmi:
+		{
+			// every VBMI CPU but Cannon Lake has VBMI2
+			std::size_t position = 0;
+			if (detail::hasVbmi2())
+			{
+				position = detail::stripWhitespaceAvx512Vbmi2(input, size, output, written);
+			}
+			return position + detail::stripWhitespaceAvx2(input + position, size - position
+					, output, written);
+		}
+		case SimdLevel::Avx512:
+		case SimdLevel::Avx2:
+			return detail::stripWhitespaceAvx2(input, size, output, written);
+		case SimdLevel::Ssse3:
+			return detail::stripWhitespaceSsse3(input, size, output, written);
+		case SimdLevel::Scalar:
+			break;
+	}
+#else
+	(void)level;
+	(void)input;
+	(void)size;
+	(void)output;
+	(void)written;
+#endif
+	return 0;
+}
+
+} // namespace simd
+
+} // namespace base_coder
+
+#endif // BASECODER_SIMD_HPP
@@ -0,0 +1,381 @@
+#ifndef BASECODER_STREAM_HPP
+#define BASECODER_STREAM_HPP
+
+#include <BaseCoder/BaseCoder.hpp>
+
+#include <algorithm>
+#include <array>
+
+namespace base_coder
+{
+
+///
+/// \brief The StreamEncoder class: encoding of data received by chunks
+/// \tparam Trait
+///
+template<typename Trait>
+class StreamEncoder : private BaseCoder<Trait>
+{
+	using Coder = BaseCoder<Trait>;
+
+public:
+	using typename Coder::AlphabetType;
+
+	using Coder::inputBufferSize;
+	using Coder::indexBufferSize;
+
+	///
+	/// \brief update
+	/// \tparam InputIterator
+	/// \tparam OutputIterator
+	/// \param chunk next part of input data
+	/// \param outputIterator
+	/// \return output iterator after written characters
+	///
+	template<typename InputIterator, typename OutputIterator>
+	OutputIterator update(View<InputIterator> chunk, OutputIterator outputIterator);
+
+	///
+	/// \brief update
+	/// \tparam Container
+	/// \tparam OutputIterator
+	/// \param chunk next part of input data
+	/// \param outputIterator
+	/// \return output iterator after written characters
+	///
+	template<typename Container, typename OutputIterator>
+	OutputIterator update(const Container &chunk, OutputIterator outputIterator);
+
+	///
+	/// \brief finish: encode carried bytes with pad, if padding allows it, and reset state
+	/// \tparam OutputIterator
+	/// \param outputIterator
+	/// \return output iterator after written characters
+	///
+	template<typename OutputIterator>
+	OutputIterator finish(OutputIterator outputIterator);
+
+	///
+	/// \brief reset: drop carried bytes
+	///
+	void reset();
+
+private:
+	using typename Coder::EncodeInput;
+	using typename Coder::EncodeOutput;
+
+	///
+	/// \brief updateContiguous
+	/// \tparam OutputIterator
+	/// \param input
+	/// \param size
+	/// \param outputIterator
+	/// \return output iterator after written characters
+	///
+	template<typename OutputIterator>
+	OutputIterator updateContiguous(const std::uint8_t *input, std::size_t size
+			, OutputIterator outputIterator);
+
+private:
+	EncodeInput carry{}; ///< bytes of incomplete block
+	std::size_t carrySize = 0; ///<
+};
+
+///
+/// \brief The StreamDecoder class: decoding of data received by chunks
+/// \tparam Trait
+///
+template<typename Trait>
+class StreamDecoder : private BaseCoder<Trait>
+{
+	using Coder = BaseCoder<Trait>;
+
+public:
+	using typename Coder::AlphabetType;
+
+	using Coder::inputBufferSize;
+	using Coder::indexBufferSize;
+
+	///
+	/// \brief update
+	/// \tparam InputIterator
+	/// \tparam OutputIterator
+	/// \param chunk next part of encoded data
+	/// \param outputIterator
+	/// \return output iterator after written bytes
+	///
+	template<typename InputIterator, typename OutputIterator>
+	OutputIterator update(View<InputIterator> chunk, OutputIterator outputIterator);
+
+	///
+	/// \brief update
+	/// \tparam Container
+	/// \tparam OutputIterator
+	/// \param chunk next part of encoded data
+	/// \param outputIterator
+	/// \return output iterator after written bytes
+	///
+	template<typename Container, typename OutputIterator>
+	OutputIterator update(const Container &chunk, OutputIterator outputIterator);
+
+	///
+	/// \brief finish: decode carried unpadded characters and reset state
+	/// \tparam OutputIterator
+	/// \param outputIterator
+	/// \return output iterator after written bytes
+	///
+	template<typename OutputIterator>
+	OutputIterator finish(OutputIterator outputIterator);
+
+	///
+	/// \brief reset: drop carried characters
+	///
+	void reset();
+
+private:
+	///
+	/// \brief updateContiguous
+	/// \tparam OutputIterator
+	/// \param input
+	/// \param size
+	/// \param outputIterator
+	/// \return output iterator after written bytes
+	///
+	template<typename OutputIterator>
+	OutputIterator updateContiguous(const AlphabetType *input, std::size_t size
+			, OutputIterator outputIterator);
+
+	///
+	/// \brief decodeWhole: decode data with complete or last block
+	/// \tparam OutputIterator
+	/// \param input
+	/// \param size
+	/// \param outputIterator
+	/// \return output iterator after written bytes
+	///
+	template<typename OutputIterator>
+	OutputIterator decodeWhole(const AlphabetType *input, std::size_t size
+			, OutputIterator outputIterator) const;
+
+private:
+	std::array<AlphabetType, indexBufferSize> carry{}; ///< characters of incomplete block
+	std::size_t carrySize = 0; ///<
+};
+
+// StreamEncoder
+
+template<typename Trait>
+template<typename InputIterator, typename OutputIterator>
+OutputIterator StreamEncoder<Trait>::update(View<InputIterator> chunk
+		, OutputIterator outputIterator)
+{
+	if constexpr (View<InputIterator>::isContiguous)
+	{
+		return updateContiguous(reinterpret_cast<const std::uint8_t *>(chunk.data())
+				, chunk.size(), outputIterator);
+	}
+	else
+	{
+		std::array<std::uint8_t, inputBufferSize * Coder::stagingBlocks> input;
+		std::size_t inputIndex = 0;
+		for (auto i : chunk)
+		{
+			input[inputIndex++] = i;
+
+			if (inputIndex == input.size())
+			{
+				outputIterator = updateContiguous(input.data(), inputIndex, outputIterator);
+				inputIndex = 0;
+			}
+		}
+		return updateContiguous(input.data(), inputIndex, outputIterator);
+	}
+}
+
+template<typename Trait>
+template<typename Container, typename OutputIterator>
+OutputIterator StreamEncoder<Trait>::update(const Container &chunk
+		, OutputIterator outputIterator)
+{
+	return update(makeConstView(chunk), outputIterator);
+}
+
+template<typename Trait>
+template<typename OutputIterator>
+OutputIterator StreamEncoder<Trait>::finish(OutputIterator outputIterator)
+{
+	if (carrySize)
+	{
+		std::array<AlphabetType, indexBufferSize> output;
+		const std::size_t written = this->encodeTail(carry.data(), carrySize
+				, output.data());
+		outputIterator = std::copy(output.begin(), output.begin() + written
+				, outputIterator);
+	}
+	reset();
+	return outputIterator;
+}
+
+template<typename Trait>
+void StreamEncoder<Trait>::reset()
+{
+	carrySize = 0;
+}
+
+template<typename Trait>
+template<typename OutputIterator>
+OutputIterator StreamEncoder<Trait>::updateContiguous(const std::uint8_t *input
+		, std::size_t size, OutputIterator outputIterator)
+{
+	if (carrySize)
+	{
+		const std::size_t count = std::min(size, inputBufferSize - carrySize);
+		std::copy(input, input + count, carry.begin() + carrySize);
+		carrySize += count;
+		input += count;
+		size -= count;
+		if (carrySize != inputBufferSize)
+		{
+			return outputIterator;
+		}
+		const EncodeOutput encodeOutput = this->coreEncode(carry);
+		outputIterator = std::copy(encodeOutput.begin(), encodeOutput.end()
+				, outputIterator);
+		carrySize = 0;
+	}
+
+	const std::size_t wholeSize = size - size % inputBufferSize;
+	if constexpr (std::is_same_v<OutputIterator, AlphabetType *>)
+	{
+		outputIterator += this->encodeBlocks(input, wholeSize, outputIterator);
+	}
+	else
+	{
+		constexpr std::size_t chunkSize = inputBufferSize * Coder::stagingBlocks;
+		std::array<AlphabetType, indexBufferSize * Coder::stagingBlocks> output;
+		for (std::size_t position = 0; position != wholeSize; )
+		{
+			const std::size_t count = std::min(chunkSize, wholeSize - position);
+			const std::size_t written = this->encodeBlocks(input + position, count
+					, output.data());
+			outputIterator = std::copy(output.data(), output.data() + written
+					, outputIterator);
+			position += count;
+		}
+	}
+
+	carrySize = size - wholeSize;
+	std::copy(input + wholeSize, input + size, carry.begin());
+	return outputIterator;
+}
+
+// StreamDecoder
+
+template<typename Trait>
+template<typename InputIterator, typename OutputIterator>
+OutputIterator StreamDecoder<Trait>::update(View<InputIterator> chunk
+		, OutputIterator outputIterator)
+{
+	if constexpr (View<InputIterator>::isContiguous)
+	{
+		return updateContiguous(reinterpret_cast<const AlphabetType *>(chunk.data())
+				, chunk.size(), outputIterator);
+	}
+	else
+	{
+		std::array<AlphabetType, indexBufferSize * Coder::stagingBlocks> input;
+		std::size_t inputIndex = 0;
+		for (auto i : chunk)
+		{
+			input[inputIndex++] = i;
+
+			if (inputIndex == input.size())
+			{
+				outputIterator = updateContiguous(input.data(), inputIndex, outputIterator);
+				inputIndex = 0;
+			}
+		}
+		return updateContiguous(input.data(), inputIndex, outputIterator);
+	}
+}
+
+template<typename Trait>
+template<typename Container, typename OutputIterator>
+OutputIterator StreamDecoder<Trait>::update(const Container &chunk
+		, OutputIterator outputIterator)
+{
+	return update(makeConstView(chunk), outputIterator);
+}
+
+template<typename Trait>
+template<typename OutputIterator>
+OutputIterator StreamDecoder<Trait>::finish(OutputIterator outputIterator)
+{
+	outputIterator = decodeWhole(carry.data(), carrySize, outputIterator);
+	reset();
+	return outputIterator;
+}
+
+template<typename Trait>
+void StreamDecoder<Trait>::reset()
+{
+	carrySize = 0;
+}
+
+template<typename Trait>
+template<typename OutputIterator>
+OutputIterator StreamDecoder<Trait>::updateContiguous(const AlphabetType *input
+		, std::size_t size, OutputIterator outputIterator)
+{
+	if (carrySize)
+	{
+		const std::size_t count = std::min(size, indexBufferSize - carrySize);
+		std::copy(input, input + count, carry.begin() + carrySize);
+		carrySize += count;
+		input += count;
+		size -= count;
+		if (carrySize != indexBufferSize)
+		{
+			return outputIterator;
+		}
+		outputIterator = decodeWhole(carry.data(), carrySize, outputIterator);
+		carrySize = 0;
+	}
+
+	const std::size_t wholeSize = size - size % indexBufferSize;
+	outputIterator = decodeWhole(input, wholeSize, outputIterator);
+
+	carrySize = size - wholeSize;
+	std::copy(input + wholeSize, input + size, carry.begin());
+	return outputIterator;
+}
+
+template<typename Trait>
+template<typename OutputIterator>
+OutputIterator StreamDecoder<Trait>::decodeWhole(const AlphabetType *input
+		, std::size_t size, OutputIterator outputIterator) const
+{
+	if constexpr (std::is_same_v<OutputIterator, std::uint8_t *>)
+	{
+		return outputIterator + this->decode(input, size, outputIterator);
+	}
+	else
+	{
+		constexpr std::size_t chunkSize = indexBufferSize * Coder::stagingBlocks;
+		std::array<std::uint8_t, inputBufferSize * Coder::stagingBlocks> output;
+		for (std::size_t position = 0; position != size; )
+		{
+			const std::size_t count = std::min(chunkSize, size - position);
+			const std::size_t written = this->decode(input + position, count
+					, output.data());
+			outputIterator = std::copy(output.data(), output.data() + written
+					, outputIterator);
+			position += count;
+		}
+		return outputIterator;
+	}
+}
+
+} // namespace base_coder
+
+#endif // BASECODER_STREAM_HPP
@@ -0,0 +1,253 @@
+#ifndef BASECODER_SWAR_HPP
+#define BASECODER_SWAR_HPP
+
+#include <BaseCoder/Traits.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <cstdlib>
+#endif
+
+namespace base_coder
+{
+
+namespace swar
+{
+
+///
+/// \brief encode: portable processing of whole blocks in 64-bit registers
+/// \tparam Trait
+/// \param input
+/// \param size count of input bytes, multiple of Trait::inputBufferSize
+/// \param output buffer for size / inputBufferSize * indexBufferSize characters
+/// \return count of consumed input bytes, always size
+///
+template<typename Trait>
+std::size_t encode(const std::uint8_t *input, std::size_t size
+		, typename Trait::AlphabetType *output);
+
+///
+/// \brief decode: portable processing of whole blocks in 64-bit registers
+/// \tparam Trait
+/// \param input
+/// \param size count of input characters, multiple of Trait::indexBufferSize
+/// \param output buffer for size / indexBufferSize * inputBufferSize bytes
+/// \return count of consumed input characters, multiple of Trait::indexBufferSize;
+/// processing stops before word with pad or invalid character
+///
+template<typename Trait>
+std::size_t decode(const typename Trait::AlphabetType *input, std::size_t size
+		, std::uint8_t *output);
+
+namespace detail
+{
+
+using Word = std::uint64_t;
+
+constexpr std::size_t wordBitSize = sizeof(Word) * CHAR_BIT;
+
+inline Word byteSwap(Word value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_bswap64(value);
+#elif defined(_MSC_VER)
+	return _byteswap_uint64(value);
+#else
+	Word result = 0;
+	for (std::size_t i = 0; i != sizeof(Word); ++i)
+	{
+		result = (result << CHAR_BIT) | ((value >> (i * CHAR_BIT)) & 0xFF);
+	}
+	return result;
+#endif
+}
+
+///
+/// \brief toBigEndian: conversion between native and big-endian byte order
+///
+inline Word toBigEndian(Word value)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	return value;
+#else
+	return byteSwap(value);
+#endif
+}
+
+///
+/// \brief loadBigEndian
+/// \param data at least 8 readable bytes
+/// \return the first byte of data in the highest bits
+///
+inline Word loadBigEndian(const void *data)
+{
+	Word value;
+	std::memcpy(&value, data, sizeof(value));
+	return toBigEndian(value);
+}
+
+///
+/// \brief storeBigEndian: store SIZE highest bytes of value
+///
+template<std::size_t SIZE>
+void storeBigEndian(void *data, Word value)
+{
+	value = toBigEndian(value);
+	std::memcpy(data, &value, SIZE);
+}
+
+///
+/// \brief The Layout struct: blocks processed in one word
+/// \tparam Trait
+///
+template<typename Trait>
+struct Layout
+{
+	static constexpr std::size_t encodeBlockCount = sizeof(Word) / Trait::inputBufferSize;
+	static constexpr std::size_t encodeByteCount = encodeBlockCount * Trait::inputBufferSize;
+	static constexpr std::size_t encodeCharCount = encodeBlockCount * Trait::indexBufferSize;
+
+	static constexpr std::size_t decodeBlockCount = sizeof(Word) / Trait::indexBufferSize;
+	static constexpr std::size_t decodeCharCount = decodeBlockCount * Trait::indexBufferSize;
+	static constexpr std::size_t decodeByteCount = decodeBlockCount * Trait::inputBufferSize;
+
+	static constexpr std::size_t pairBitSize = 2 * Trait::indexBitSize;
+};
+
+///
+/// \brief makePairAlphabet
+/// \tparam Trait
+/// \return table: two concatenated indices -> two characters
+///
+template<typename Trait>
+constexpr std::array<std::uint16_t, std::size_t{ 1 } << Layout<Trait>::pairBitSize>
+makePairAlphabet()
+{
+	static_assert(sizeof(typename Trait::AlphabetType) == 1, "Need one byte characters");
+
+	std::array<std::uint16_t, std::size_t{ 1 } << Layout<Trait>::pairBitSize> pairAlphabet{};
+	for (std::size_t i = 0; i != pairAlphabet.size(); ++i)
+	{
+		const std::uint16_t first = static_cast<std::uint8_t>(
+				Trait::alphabet[i >> Trait::indexBitSize]);
+		const std::uint16_t second = static_cast<std::uint8_t>(
+				Trait::alphabet[i & ((1u << Trait::indexBitSize) - 1)]);
+		// pair is stored as native 16-bit number
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		pairAlphabet[i] = static_cast<std::uint16_t>((first << CHAR_BIT) | second);
+#else
+		pairAlphabet[i] = static_cast<std::uint16_t>((second << CHAR_BIT) | first);
+#endif
+	}
+	return pairAlphabet;
+}
+
+template<typename Trait>
+constexpr auto pairAlphabet = makePairAlphabet<Trait>();
+
+template<typename Trait, std::size_t... PAIRS>
+void encodeWord(Word value, typename Trait::AlphabetType *output
+		, std::index_sequence<PAIRS...>)
+{
+	constexpr std::size_t pairBitSize = Layout<Trait>::pairBitSize;
+	constexpr Word mask = (Word{ 1 } << pairBitSize) - 1;
+	const std::uint16_t pairs[] = { pairAlphabet<Trait>[
+			(value >> (wordBitSize - (PAIRS + 1) * pairBitSize)) & mask]... };
+	std::memcpy(output, pairs, sizeof(pairs));
+}
+
+///
+/// \brief decodeWord
+/// \param input sizeof(Word) characters
+/// \param output buffer for Layout<Trait>::decodeByteCount bytes
+/// \return false if input contains pad or invalid character
+///
+template<typename Trait, std::size_t... CHARS>
+bool decodeWord(const typename Trait::AlphabetType *input, std::uint8_t *output
+		, std::index_sequence<CHARS...>)
+{
+	const std::uint8_t indices[] = { Trait::reverseAlphabet[
+			static_cast<std::uint8_t>(input[CHARS])]... };
+
+	// valid indices are less than 0x80, invalidIndex and padIndex are not
+	if ((indices[CHARS] | ...) & 0x80)
+	{
+		return false;
+	}
+	const Word value = ((Word{ indices[CHARS] }
+			<< (wordBitSize - (CHARS + 1) * Trait::indexBitSize)) | ...);
+	storeBigEndian<Layout<Trait>::decodeByteCount>(output, value);
+	return true;
+}
+
+} // namespace detail
+
+template<typename Trait>
+std::size_t encode(const std::uint8_t *input, std::size_t size
+		, typename Trait::AlphabetType *output)
+{
+	using Layout = detail::Layout<Trait>;
+	using Pairs = std::make_index_sequence<Layout::encodeCharCount / 2>;
+
+	std::size_t position = 0;
+	for (; size - position >= sizeof(detail::Word); position += Layout::encodeByteCount
+			, output += Layout::encodeCharCount)
+	{
+		detail::encodeWord<Trait>(detail::loadBigEndian(input + position), output, Pairs{});
+	}
+	if (position != size)
+	{
+		std::array<std::uint8_t, sizeof(detail::Word)> word{};
+		std::memcpy(word.data(), input + position, size - position);
+		std::array<typename Trait::AlphabetType, Layout::encodeCharCount> characters;
+		detail::encodeWord<Trait>(detail::loadBigEndian(word.data()), characters.data()
+				, Pairs{});
+		std::memcpy(output, characters.data()
+				, (size - position) / Trait::inputBufferSize * Trait::indexBufferSize);
+	}
+	return size;
+}
+
+template<typename Trait>
+std::size_t decode(const typename Trait::AlphabetType *input, std::size_t size
+		, std::uint8_t *output)
+{
+	using Layout = detail::Layout<Trait>;
+	using Chars = std::make_index_sequence<sizeof(detail::Word)>;
+
+	std::size_t position = 0;
+	for (; size - position >= sizeof(detail::Word); position += Layout::decodeCharCount
+			, output += Layout::decodeByteCount)
+	{
+		if (!detail::decodeWord<Trait>(input + position, output, Chars{}))
+		{
+			return position;
+		}
+	}
+	if (position != size)
+	{
+		std::array<typename Trait::AlphabetType, sizeof(detail::Word)> word;
+		word.fill(Trait::alphabet[0]);
+		std::memcpy(word.data(), input + position, size - position);
+		std::array<std::uint8_t, Layout::decodeByteCount> bytes;
+		if (!detail::decodeWord<Trait>(word.data(), bytes.data(), Chars{}))
+		{
+			return position;
+		}
+		std::memcpy(output, bytes.data()
+				, (size - position) / Trait::indexBufferSize * Trait::inputBufferSize);
+		position = size;
+	}
+	return position;
+}
+
+} // namespace swar
+
+} // namespace base_coder
+
+#endif // BASECODER_SWAR_HPP
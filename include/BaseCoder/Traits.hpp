@@ -1,6 +1,7 @@
 #ifndef BASECODER_BASECODER_TRAITS_HPP
 #define BASECODER_BASECODER_TRAITS_HPP
 
+#include <array>
 #include <climits>
 #include <cstdint>
 
@@ -26,7 +27,18 @@ enum class Type
 ///
 enum class Subtype
 {
-	Common, Hex
+	Common, Hex, Lower, ///< Lower is Base16 with lowercase letters
+	Custom ///< alphabet of CustomTraits
+};
+
+///
+/// \brief The Padding enum: pad after the last incomplete block
+///
+enum class Padding
+{
+	Required, ///< written by encode, checked decode rejects data without it
+	Optional, ///< written by encode, checked decode accepts data with or without it
+	Forbidden ///< not written by encode (RFC 4648 section 3.2), checked decode rejects it
 };
 
 ///
@@ -91,10 +103,80 @@ struct AlphabetTraits<Type::Base16, Subtype::Common>
 	static constexpr AlphabetType pad = '=';
 };
 
+///
+/// \brief The AlphabetTraits<Type::BASE16, Subtype::LOWER> struct
+///
+template<>
+struct AlphabetTraits<Type::Base16, Subtype::Lower>
+{
+	using AlphabetType = char;
+	static constexpr AlphabetType alphabet[] = "0123456789abcdef";
+	static constexpr auto alphabetSize = (sizeof(alphabet) / sizeof(AlphabetType)) - 1;
+	static constexpr AlphabetType pad = '=';
+};
+
+namespace detail
+{
+
+///
+/// \brief Index of reverse alphabet for characters outside of alphabet
+///
+constexpr std::uint8_t invalidIndex = 0xFF;
+
+///
+/// \brief Index of reverse alphabet for pad character
+///
+constexpr std::uint8_t padIndex = 0xFE;
+
+///
+/// \brief makeRadixReverseAlphabet: character -> index in alphabet without pad
+/// \tparam Alphabet traits with alphabet and alphabetSize
+/// \tparam CASE_INSENSITIVE letters of the other case are mapped to the same index
+/// \return 256-entry table with invalidIndex for non-alphabet characters
+///
+template<typename Alphabet, bool CASE_INSENSITIVE = false>
+constexpr std::array<std::uint8_t, 1 << CHAR_BIT> makeRadixReverseAlphabet()
+{
+	std::array<std::uint8_t, 1 << CHAR_BIT> reverseAlphabet{};
+	for (auto &i : reverseAlphabet)
+	{
+		i = invalidIndex;
+	}
+	for (std::size_t i = 0; i < Alphabet::alphabetSize; ++i)
+	{
+		const auto character = static_cast<std::uint8_t>(Alphabet::alphabet[i]);
+		reverseAlphabet[character] = static_cast<std::uint8_t>(i);
+		if (CASE_INSENSITIVE && ((character | 0x20) >= 'a' && (character | 0x20) <= 'z'))
+		{
+			reverseAlphabet[character ^ 0x20] = static_cast<std::uint8_t>(i);
+		}
+	}
+	return reverseAlphabet;
+}
+
+///
+/// \brief Making reverse alphabet: character -> index in alphabet
+/// \tparam Alphabet AlphabetTraits specialization
+/// \tparam CASE_INSENSITIVE letters of the other case are mapped to the same index
+/// \return 256-entry table with invalidIndex/padIndex for non-alphabet characters
+///
+template<typename Alphabet, bool CASE_INSENSITIVE = false>
+constexpr std::array<std::uint8_t, 1 << CHAR_BIT> makeReverseAlphabet()
+{
+	auto reverseAlphabet = makeRadixReverseAlphabet<Alphabet, CASE_INSENSITIVE>();
+	reverseAlphabet[static_cast<std::uint8_t>(Alphabet::pad)] = padIndex;
+	return reverseAlphabet;
+}
+
+} // namespace detail
+
 ///
 /// \brief The Traits struct
+/// \tparam TYPE
+/// \tparam SUBTYPE
+/// \tparam PADDING
 ///
-template<Type TYPE, Subtype SUBTYPE>
+template<Type TYPE, Subtype SUBTYPE, Padding PADDING = Padding::Optional>
 struct Traits : public AlphabetTraits<TYPE, SUBTYPE>
 {
 	using AlphabetTraits<TYPE, SUBTYPE>::AlphabetType;
@@ -102,9 +184,18 @@ struct Traits : public AlphabetTraits<TYPE, SUBTYPE>
 	using AlphabetTraits<TYPE, SUBTYPE>::pad;
 
 	static_assert(!(TYPE == Type::Base16 && SUBTYPE == Subtype::Hex), "Imposible format");
+	static_assert(!(TYPE != Type::Base16 && SUBTYPE == Subtype::Lower), "Imposible format");
+	static_assert(SUBTYPE != Subtype::Custom, "Custom alphabet needs CustomTraits");
 
 	static constexpr auto type = TYPE;
 	static constexpr auto subtype = SUBTYPE;
+	static constexpr auto padding = PADDING;
+
+	static constexpr std::uint8_t invalidIndex = detail::invalidIndex;
+	static constexpr std::uint8_t padIndex = detail::padIndex;
+	// Base16 is case-insensitive (RFC 4648 section 8), any subtype decodes mixed case
+	static constexpr auto reverseAlphabet =
+			detail::makeReverseAlphabet<AlphabetTraits<TYPE, SUBTYPE>, TYPE == Type::Base16>();
 
 	static constexpr std::size_t indexBitSize = (TYPE == Type::Base64) ? 6
 			: (TYPE == Type::Base32) ? 5 : 4;
@@ -121,6 +212,174 @@ using Base64HexTraits = Traits<Type::Base64, Subtype::Hex>;
 using Base32Traits = Traits<Type::Base32, Subtype::Common>;
 using Base32HexTraits = Traits<Type::Base32, Subtype::Hex>;
 using Base16Traits = Traits<Type::Base16, Subtype::Common>;
+using Base16LowerTraits = Traits<Type::Base16, Subtype::Lower>;
+
+using Base64HexUnpaddedTraits = Traits<Type::Base64, Subtype::Hex, Padding::Forbidden>;
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+///
+/// \brief The FixedString struct: string literal as template argument
+/// \tparam SIZE size of literal including terminating null
+///
+template<std::size_t SIZE>
+struct FixedString
+{
+	constexpr FixedString(const char (&literal)[SIZE])
+	{
+		for (std::size_t i = 0; i != SIZE; ++i)
+		{
+			value[i] = literal[i];
+		}
+	}
+
+	static constexpr std::size_t size()
+	{
+		return SIZE - 1;
+	}
+
+	char value[SIZE]{}; ///<
+};
+
+namespace detail
+{
+
+///
+/// \brief alphabetBitSize
+/// \param size count of characters in alphabet
+/// \return count of bits coded by one character, zero if size isn't 16, 32 or 64
+///
+constexpr std::size_t alphabetBitSize(std::size_t size)
+{
+	return (size == 64) ? 6 : (size == 32) ? 5 : (size == 16) ? 4 : 0;
+}
+
+///
+/// \brief isUniqueAlphabet
+/// \param alphabet
+/// \param size
+/// \param pad
+/// \return true if characters of alphabet and pad are distinct
+///
+constexpr bool isUniqueAlphabet(const char *alphabet, std::size_t size, char pad)
+{
+	bool used[1 << CHAR_BIT]{};
+	used[static_cast<std::uint8_t>(pad)] = true;
+	for (std::size_t i = 0; i != size; ++i)
+	{
+		const auto character = static_cast<std::uint8_t>(alphabet[i]);
+		if (used[character])
+		{
+			return false;
+		}
+		used[character] = true;
+	}
+	return true;
+}
+
+///
+/// \brief The CustomAlphabet struct: AlphabetTraits of CustomTraits
+/// \tparam ALPHABET
+/// \tparam PAD
+///
+template<FixedString ALPHABET, char PAD>
+struct CustomAlphabet
+{
+	using AlphabetType = char;
+	static constexpr const AlphabetType (&alphabet)[ALPHABET.size() + 1] = ALPHABET.value;
+	static constexpr auto alphabetSize = ALPHABET.size();
+	static constexpr AlphabetType pad = PAD;
+};
+
+} // namespace detail
+
+///
+/// \brief The CustomTraits struct: user-defined alphabet, like Crockford's
+/// Base32 or bcrypt's Base64. Bits are packed as in RFC 4648, decoding
+/// accepts only characters of alphabet
+/// \tparam ALPHABET characters of indices 0..2^BITS - 1
+/// \tparam PAD
+/// \tparam BITS count of bits coded by one character: 6, 5 or 4
+/// \tparam PADDING
+///
+template<FixedString ALPHABET, char PAD = '='
+		, std::size_t BITS = detail::alphabetBitSize(ALPHABET.size())
+		, Padding PADDING = Padding::Optional>
+struct CustomTraits : public detail::CustomAlphabet<ALPHABET, PAD>
+{
+	using typename detail::CustomAlphabet<ALPHABET, PAD>::AlphabetType;
+	using detail::CustomAlphabet<ALPHABET, PAD>::alphabet;
+	using detail::CustomAlphabet<ALPHABET, PAD>::alphabetSize;
+	using detail::CustomAlphabet<ALPHABET, PAD>::pad;
+
+	static_assert(BITS >= 4 && BITS <= 6, "Alphabet of 16, 32 or 64 characters is needed");
+	static_assert(ALPHABET.size() == (std::size_t{ 1 } << BITS)
+			, "Size of alphabet doesn't match count of bits");
+	static_assert(detail::isUniqueAlphabet(ALPHABET.value, ALPHABET.size(), PAD)
+			, "Duplicate character in alphabet or pad");
+
+	static constexpr auto type = (BITS == 6) ? Type::Base64
+			: (BITS == 5) ? Type::Base32 : Type::Base16;
+	static constexpr auto subtype = Subtype::Custom;
+	static constexpr auto padding = PADDING;
+
+	static constexpr std::uint8_t invalidIndex = detail::invalidIndex;
+	static constexpr std::uint8_t padIndex = detail::padIndex;
+	static constexpr auto reverseAlphabet =
+			detail::makeReverseAlphabet<detail::CustomAlphabet<ALPHABET, PAD>>();
+
+	static constexpr std::size_t indexBitSize = BITS;
+	static constexpr std::size_t indexBufferSize = (BITS == 6) ? 4 : (BITS == 5) ? 8 : 2;
+
+	static constexpr std::size_t indexBufferSizeInBits = indexBitSize * indexBufferSize;
+
+	static constexpr std::size_t inputBufferSize = indexBufferSizeInBits / CHAR_BIT;
+};
+
+namespace detail
+{
+
+///
+/// \brief makeCrockfordReverseAlphabet
+/// \tparam Alphabet AlphabetTraits of Crockford's Base32
+/// \return case-insensitive reverse alphabet, 'O' is decoded as '0', 'I' and
+/// 'L' as '1'
+///
+template<typename Alphabet>
+constexpr std::array<std::uint8_t, 1 << CHAR_BIT> makeCrockfordReverseAlphabet()
+{
+	auto reverseAlphabet = makeReverseAlphabet<Alphabet, true>();
+	for (const char *alias : { "O0", "I1", "L1" })
+	{
+		const auto index = reverseAlphabet[static_cast<std::uint8_t>(alias[1])];
+		reverseAlphabet[static_cast<std::uint8_t>(alias[0])] = index;
+		reverseAlphabet[static_cast<std::uint8_t>(alias[0] ^ 0x20)] = index;
+	}
+	return reverseAlphabet;
+}
+
+} // namespace detail
+
+///
+/// \brief The Base32CrockfordTraits struct: Crockford's Base32, decoding is
+/// case-insensitive and maps aliases 'O' -> '0', 'I', 'L' -> '1'; hyphens
+/// aren't skipped
+///
+struct Base32CrockfordTraits : public CustomTraits<"0123456789ABCDEFGHJKMNPQRSTVWXYZ", '=', 5
+		, Padding::Forbidden>
+{
+	static constexpr auto reverseAlphabet = detail::makeCrockfordReverseAlphabet<
+			detail::CustomAlphabet<"0123456789ABCDEFGHJKMNPQRSTVWXYZ", '='>>();
+};
+/// z-base-32 of Tahoe-LAFS
+using ZBase32Traits = CustomTraits<"ybndrfg8ejkmcpqxot1uwisza345h769", '=', 5
+		, Padding::Forbidden>;
+/// Base64 of bcrypt hashes
+using Base64BcryptTraits = CustomTraits<"./ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+		"abcdefghijklmnopqrstuvwxyz0123456789", '=', 6, Padding::Forbidden>;
+/// modified Base64 of IMAP mailbox names (RFC 3501 section 5.1.3)
+using Base64ImapTraits = CustomTraits<"ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+		"abcdefghijklmnopqrstuvwxyz0123456789+,", '=', 6, Padding::Forbidden>;
+#endif
 
 } // namespace base_coder
 
@@ -0,0 +1,265 @@
+#ifndef BASECODER_TRANSCODE_HPP
+#define BASECODER_TRANSCODE_HPP
+
+#include <BaseCoder/BaseCoder.hpp>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+namespace base_coder
+{
+
+///
+/// \brief upperBoundTranscodeSize
+/// \tparam FromTrait
+/// \tparam ToTrait
+/// \param size count of input characters
+/// \return maximal count of output characters, without looking at data
+///
+template<typename FromTrait, typename ToTrait>
+constexpr std::size_t upperBoundTranscodeSize(std::size_t size);
+
+///
+/// \brief transcodeSize
+/// \tparam FromTrait
+/// \tparam ToTrait
+/// \param input
+/// \param size count of input characters
+/// \return count of output characters for valid input
+///
+template<typename FromTrait, typename ToTrait>
+std::size_t transcodeSize(const typename FromTrait::AlphabetType *input, std::size_t size);
+
+///
+/// \brief transcode: checked decoding of FromTrait data and encoding it with
+/// ToTrait in one pass over input. Formats of the same type are remapped
+/// character by character, others go through buffer of whole blocks of both
+/// \tparam FromTrait
+/// \tparam ToTrait
+/// \param input
+/// \param size count of input characters
+/// \param output buffer for upperBoundTranscodeSize characters
+/// \return status, offset of the first bad character in input and count of
+/// written characters, only whole blocks of valid data on error
+///
+template<typename FromTrait, typename ToTrait>
+DecodeResult transcode(const typename FromTrait::AlphabetType *input, std::size_t size
+		, typename ToTrait::AlphabetType *output);
+
+#if defined(__cpp_lib_span)
+///
+/// \brief transcode
+/// \tparam FromTrait
+/// \tparam ToTrait
+/// \param input
+/// \param output buffer for upperBoundTranscodeSize characters
+/// \return status, offset of the first bad character in input and count of
+/// written characters
+///
+template<typename FromTrait, typename ToTrait>
+DecodeResult transcode(std::span<const typename FromTrait::AlphabetType> input
+		, std::span<typename ToTrait::AlphabetType> output);
+#endif
+
+namespace detail
+{
+
+///
+/// \brief The TranscodeCoder class: access to block sizes of encoded data
+/// \tparam Trait
+///
+template<typename Trait>
+class TranscodeCoder : public BaseCoder<Trait>
+{
+public:
+	using BaseCoder<Trait>::encodedSize;
+};
+
+///
+/// \brief Count of bytes buffered between decoding and encoding, whole blocks
+/// of both formats
+///
+template<typename FromTrait, typename ToTrait>
+constexpr std::size_t transcodeChunkSize = (std::size_t{ 16 } << 10)
+		/ std::lcm(FromTrait::inputBufferSize, ToTrait::inputBufferSize)
+		* std::lcm(FromTrait::inputBufferSize, ToTrait::inputBufferSize);
+
+///
+/// \brief makeRemapAlphabet
+/// \return table: character of FromTrait -> character of ToTrait with the same
+/// index, zero for pad and invalid characters
+///
+template<typename FromTrait, typename ToTrait>
+constexpr std::array<typename ToTrait::AlphabetType, 1 << CHAR_BIT> makeRemapAlphabet()
+{
+	std::array<typename ToTrait::AlphabetType, 1 << CHAR_BIT> remap{};
+	for (std::size_t i = 0; i != remap.size(); ++i)
+	{
+		const std::uint8_t index = FromTrait::reverseAlphabet[i];
+		remap[i] = (index < FromTrait::alphabetSize) ? ToTrait::alphabet[index] : 0;
+	}
+	return remap;
+}
+
+template<typename FromTrait, typename ToTrait>
+constexpr auto remapAlphabet = makeRemapAlphabet<FromTrait, ToTrait>();
+
+///
+/// \brief remap: single pass over characters of formats of the same type,
+/// vector kernels map characters to indices and back in registers
+///
+template<typename FromTrait, typename ToTrait>
+DecodeResult remap(const typename FromTrait::AlphabetType *input, std::size_t size
+		, typename ToTrait::AlphabetType *output)
+{
+	static_assert(FromTrait::indexBufferSize == ToTrait::indexBufferSize, "");
+
+	constexpr std::size_t blockSize = FromTrait::indexBufferSize;
+	constexpr std::size_t chunkSize = std::size_t{ 4 } << 10;
+	const auto &table = remapAlphabet<FromTrait, ToTrait>;
+	const BaseCoder<FromTrait> coder;
+
+	std::size_t padSize = 0;
+	while (padSize < size && input[size - padSize - 1] == FromTrait::pad)
+	{
+		++padSize;
+	}
+	const std::size_t dataSize = size - padSize;
+	const std::size_t wholeSize = dataSize - dataSize % blockSize;
+
+	for (std::size_t position = 0; position != wholeSize; )
+	{
+		const std::size_t count = std::min(chunkSize, wholeSize - position);
+		const std::size_t vectorized = simd::remap<FromTrait, ToTrait>(simdLevel()
+				, input + position, count, output + position);
+		bool invalid = false;
+		for (std::size_t i = position + vectorized; i != position + count; ++i)
+		{
+			output[i] = table[static_cast<std::uint8_t>(input[i])];
+			invalid |= (output[i] == 0);
+		}
+		if (invalid)
+		{
+			// error path, checked decoding finds status and offset
+			DecodeResult result = coder.validate(input, size);
+			result.written = result.written / FromTrait::inputBufferSize * blockSize;
+			return result;
+		}
+		position += count;
+	}
+
+	// the last block is checked as separate data, the rules are the same
+	DecodeResult result = coder.validate(input + wholeSize, size - wholeSize);
+	result.errorOffset += wholeSize;
+	if (!result)
+	{
+		result.written = wholeSize;
+		return result;
+	}
+	std::size_t written = wholeSize;
+	for (; written != dataSize; ++written)
+	{
+		output[written] = table[static_cast<std::uint8_t>(input[written])];
+	}
+	if (ToTrait::padding != Padding::Forbidden && dataSize != wholeSize)
+	{
+		for (; written != wholeSize + blockSize; ++written)
+		{
+			output[written] = ToTrait::pad;
+		}
+	}
+	result.written = written;
+	return result;
+}
+
+///
+/// \brief recode: decoding to buffer in cache and encoding from it
+///
+template<typename FromTrait, typename ToTrait>
+DecodeResult recode(const typename FromTrait::AlphabetType *input, std::size_t size
+		, typename ToTrait::AlphabetType *output)
+{
+	constexpr std::size_t chunkBytes = transcodeChunkSize<FromTrait, ToTrait>;
+	constexpr std::size_t chunkSize = chunkBytes / FromTrait::inputBufferSize
+			* FromTrait::indexBufferSize;
+	const BaseCoder<FromTrait> decoder;
+	const BaseCoder<ToTrait> encoder;
+
+	std::array<std::uint8_t, chunkBytes> buffer;
+	DecodeResult result;
+	for (std::size_t position = 0; ; position += chunkSize)
+	{
+		// only the last chunk may have tail and pad
+		const bool last = (size - position <= chunkSize);
+		const std::size_t count = last ? size - position : chunkSize;
+		DecodeResult partResult = decoder.decodeChecked(input + position, count
+				, buffer.data());
+		if (partResult && !last && partResult.written != chunkBytes)
+		{
+			partResult.status = DecodeStatus::InvalidPadding;
+			partResult.errorOffset = static_cast<std::size_t>(std::find(input + position
+					, input + position + count, FromTrait::pad) - (input + position));
+		}
+
+		if (!partResult)
+		{
+			const std::size_t whole = partResult.written
+					- partResult.written % ToTrait::inputBufferSize;
+			result.written += encoder.encode(buffer.data(), whole, output + result.written);
+			result.status = partResult.status;
+			result.errorOffset = position + partResult.errorOffset;
+			return result;
+		}
+		result.written += encoder.encode(buffer.data(), partResult.written
+				, output + result.written);
+		if (last)
+		{
+			result.errorOffset = size;
+			return result;
+		}
+	}
+}
+
+} // namespace detail
+
+template<typename FromTrait, typename ToTrait>
+constexpr std::size_t upperBoundTranscodeSize(std::size_t size)
+{
+	return detail::TranscodeCoder<ToTrait>::encodedSize(
+			BaseCoder<FromTrait>::upperBoundDecodeSize(size));
+}
+
+template<typename FromTrait, typename ToTrait>
+std::size_t transcodeSize(const typename FromTrait::AlphabetType *input, std::size_t size)
+{
+	return detail::TranscodeCoder<ToTrait>::encodedSize(
+			BaseCoder<FromTrait>{}.decodeSize(View(input, input + size)));
+}
+
+template<typename FromTrait, typename ToTrait>
+DecodeResult transcode(const typename FromTrait::AlphabetType *input, std::size_t size
+		, typename ToTrait::AlphabetType *output)
+{
+	if constexpr (FromTrait::type == ToTrait::type)
+	{
+		return detail::remap<FromTrait, ToTrait>(input, size, output);
+	}
+	else
+	{
+		return detail::recode<FromTrait, ToTrait>(input, size, output);
+	}
+}
+
+#if defined(__cpp_lib_span)
+template<typename FromTrait, typename ToTrait>
+DecodeResult transcode(std::span<const typename FromTrait::AlphabetType> input
+		, std::span<typename ToTrait::AlphabetType> output)
+{
+	return transcode<FromTrait, ToTrait>(input.data(), input.size(), output.data());
+}
+#endif
+
+} // namespace base_coder
+
+#endif // BASECODER_TRANSCODE_HPP
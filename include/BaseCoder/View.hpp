@@ -1,9 +1,82 @@
+#ifndef BASECODER_VIEW_HPP
+#define BASECODER_VIEW_HPP
+
 #include <type_traits>
 #include <iterator>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace base_coder
 {
 
+namespace detail
+{
+
+///
+/// \brief isContiguousIterator
+/// \tparam Iterator
+/// \return true if elements of iterator range are stored contiguously
+///
+template<typename Iterator>
+constexpr bool isContiguousIterator()
+{
+#if defined(__cpp_lib_concepts)
+	return std::contiguous_iterator<Iterator>;
+#else
+	using Value = std::remove_cv_t<typename std::iterator_traits<Iterator>::value_type>;
+	if constexpr (std::is_pointer_v<Iterator>)
+	{
+		return true;
+	}
+	else if constexpr (std::is_same_v<Value, char>)
+	{
+		return std::is_same_v<Iterator, std::string::iterator>
+				|| std::is_same_v<Iterator, std::string::const_iterator>
+				|| std::is_same_v<Iterator, std::vector<char>::iterator>
+				|| std::is_same_v<Iterator, std::vector<char>::const_iterator>;
+	}
+	else if constexpr (!std::is_same_v<Value, bool>)
+	{
+		return std::is_same_v<Iterator, typename std::vector<Value>::iterator>
+				|| std::is_same_v<Iterator, typename std::vector<Value>::const_iterator>;
+	}
+	return false;
+#endif
+}
+
+///
+/// \brief isAlphabetIterator
+/// \tparam AlphabetType
+/// \tparam Iterator
+/// \return true if iterator yields AlphabetType or its signed/unsigned variant
+///
+template<typename AlphabetType, typename Iterator>
+constexpr bool isAlphabetIterator()
+{
+	using IteratorReturnType = std::remove_cv_t< std::remove_reference_t<
+		decltype(*std::declval<Iterator>())
+	> >;
+	return std::is_same_v<AlphabetType, IteratorReturnType>
+			|| std::is_same_v<std::make_signed_t<AlphabetType>, IteratorReturnType>
+			|| std::is_same_v<std::make_unsigned_t<AlphabetType>, IteratorReturnType>;
+}
+
+///
+/// \brief checkIteratorType
+/// \tparam AlphabetType
+/// \tparam Iterator
+///
+template<typename AlphabetType, typename Iterator>
+constexpr void checkIteratorType()
+{
+	static_assert(isAlphabetIterator<AlphabetType, Iterator>()
+			, "iterator must yield the alphabet's character type or its signed/unsigned variant");
+}
+
+} // namespace detail
+
 ///
 /// \brief The View class
 /// \tparam Iterator
@@ -12,19 +85,21 @@ template<typename Iterator>
 class View
 {
 public:
+	static constexpr bool isContiguous = detail::isContiguousIterator<Iterator>();
+
 	///
 	/// \brief View
 	/// \param begin
 	/// \param end
 	///
-	View(Iterator begin, Iterator end) : itBegin{ begin }, itEnd{ end }
+	constexpr View(Iterator begin, Iterator end) : itBegin{ begin }, itEnd{ end }
 	{}
 
 	///
 	/// \brief begin
 	/// \return
 	///
-	Iterator begin() const
+	constexpr Iterator begin() const
 	{
 		return itBegin;
 	}
@@ -33,11 +108,22 @@ public:
 	/// \brief end
 	/// \return
 	///
-	Iterator end() const
+	constexpr Iterator end() const
 	{
 		return itEnd;
 	}
 
+	///
+	/// \brief data
+	/// \return pointer to first element, only for contiguous iterators
+	///
+	auto data() const
+	{
+		static_assert(isContiguous, "View isn't contiguous");
+		using Pointer = decltype(std::addressof(*itBegin));
+		return (itBegin != itEnd) ? std::addressof(*itBegin) : Pointer{};
+	}
+
 	std::size_t size() const
 	{
 		std::size_t size = 0;
@@ -98,3 +184,5 @@ auto makeView(std::reference_wrapper<Container> ref)
 }
 
 } // namespace base_coder
+
+#endif // BASECODER_VIEW_HPP
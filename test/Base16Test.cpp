@@ -1,6 +1,9 @@
 #include "BaseCoderTest.hpp"
 #include <BaseCoder/BaseCoder.hpp>
 
+#include <cctype>
+#include <random>
+
 namespace base_coder
 {
 namespace test
@@ -83,5 +86,61 @@ TEST_F(Base16CoderTest, DecodeRfc)
 	}
 }
 
+TEST_F(Base16CoderTest, EncodeLowerRfc)
+{
+	const Base16Lower lowerCoder;
+	for (size_t i = 0; i != refereceEncodedDataBase16.size(); ++i)
+	{
+		std::string expected = refereceEncodedDataBase16[i];
+		for (auto &character : expected)
+		{
+			character = static_cast<char>(std::tolower(character));
+		}
+		std::string out;
+		lowerCoder.encode(refereceData[i], std::back_inserter(out));
+		ASSERT_EQ(expected, out);
+	}
+}
+
+TEST_F(Base16CoderTest, DecodeMixedCase)
+{
+	ASSERT_EQ(Base16Traits::reverseAlphabet['a'], Base16Traits::reverseAlphabet['A']);
+	ASSERT_EQ(Base16Traits::invalidIndex, Base16Traits::reverseAlphabet['g']);
+	ASSERT_EQ(Base16Traits::invalidIndex, Base16Traits::reverseAlphabet['G']);
+
+	const std::vector<std::uint8_t> data = makeRandomData(19, { 5000 }).front();
+	std::string encoded;
+	coder.encode(data, std::back_inserter(encoded));
+	std::mt19937 generator(19);
+	for (auto &character : encoded)
+	{
+		if (generator() % 2)
+		{
+			character = static_cast<char>(std::tolower(character));
+		}
+	}
+
+	forEachLevel([&]()
+	{
+		std::vector<std::uint8_t> out(data.size());
+		ASSERT_EQ(out.size(), coder.decode(encoded.data(), encoded.size(), out.data()));
+		ASSERT_EQ(data, out);
+
+		out.assign(data.size(), 0);
+		ASSERT_TRUE(Base16Lower{}.decodeChecked(encoded.data(), encoded.size(), out.data()));
+		ASSERT_EQ(data, out);
+
+		// letters right after 'F' and before 'A' in both cases
+		for (char bad : { 'G', 'g', '@', '`', '/', ':' })
+		{
+			std::string invalid = encoded;
+			invalid[4001] = bad;
+			const DecodeResult result = Base16Lower{}.validate(invalid.data(), invalid.size());
+			ASSERT_EQ(DecodeStatus::InvalidCharacter, result.status);
+			ASSERT_EQ(4001, result.errorOffset);
+		}
+	});
+}
+
 }
 }
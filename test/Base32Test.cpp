@@ -1,6 +1,8 @@
 #include "BaseCoderTest.hpp"
 #include <BaseCoder/BaseCoder.hpp>
 
+#include <tuple>
+
 namespace base_coder
 {
 namespace test
@@ -83,5 +85,50 @@ TEST_F(Base32CoderTest, DecodeRfc)
 	}
 }
 
+TEST_F(Base32CoderTest, KernelsRfc)
+{
+	// repeated groups are long enough for every kernel, index 0 is 'A' or '0'
+	const BaseCoder<Base32HexTraits> hexCoder;
+	const std::vector<std::tuple<std::string, std::string, std::string>> groups = {
+			{ "fooba", "MZXW6YTB", "CPNMUOJ1" }
+			, { std::string(5, '\0'), "AAAAAAAA", "00000000" }
+			, { std::string(5, '\xFF'), "77777777", "VVVVVVVV" }
+			, { std::string("\x00\x44\x32\x14\xC7", 5), "ABCDEFGH", "01234567" }
+	};
+	forEachLevel([&]()
+	{
+		for (const auto &[group, encodedGroup, hexGroup] : groups)
+		{
+			std::string data;
+			std::string expected;
+			std::string expectedHex;
+			for (size_t i = 0; i != 100; ++i)
+			{
+				data += group;
+				expected += encodedGroup;
+				expectedHex += hexGroup;
+			}
+
+			std::string encoded(expected.size(), '\0');
+			coder.encode(reinterpret_cast<const std::uint8_t *>(data.data()), data.size()
+					, encoded.data());
+			ASSERT_EQ(expected, encoded);
+			std::string hexEncoded(expectedHex.size(), '\0');
+			hexCoder.encode(reinterpret_cast<const std::uint8_t *>(data.data()), data.size()
+					, hexEncoded.data());
+			ASSERT_EQ(expectedHex, hexEncoded);
+
+			std::string decoded(data.size(), '\0');
+			ASSERT_TRUE(coder.decodeChecked(encoded.data(), encoded.size()
+					, reinterpret_cast<std::uint8_t *>(decoded.data())));
+			ASSERT_EQ(data, decoded);
+			decoded.assign(data.size(), '\0');
+			hexCoder.decode(hexEncoded.data(), hexEncoded.size()
+					, reinterpret_cast<std::uint8_t *>(decoded.data()));
+			ASSERT_EQ(data, decoded);
+		}
+	});
+}
+
 }
 }
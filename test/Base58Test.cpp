@@ -0,0 +1,155 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/Base58.hpp>
+
+#include <list>
+
+namespace base_coder
+{
+namespace test
+{
+
+namespace
+{
+
+///
+/// \brief naiveEncode: byte-at-a-time division, reference for random data
+///
+std::string naiveEncode(const std::vector<std::uint8_t> &data)
+{
+	std::size_t zeros = 0;
+	while (zeros != data.size() && data[zeros] == 0)
+	{
+		++zeros;
+	}
+	std::vector<std::uint8_t> digits;
+	for (std::size_t i = zeros; i != data.size(); ++i)
+	{
+		unsigned carry = data[i];
+		for (auto &digit : digits)
+		{
+			carry += static_cast<unsigned>(digit) << 8;
+			digit = static_cast<std::uint8_t>(carry % 58);
+			carry /= 58;
+		}
+		for (; carry; carry /= 58)
+		{
+			digits.push_back(static_cast<std::uint8_t>(carry % 58));
+		}
+	}
+	std::string encoded(zeros, Base58::alphabet[0]);
+	for (auto i = digits.rbegin(); i != digits.rend(); ++i)
+	{
+		encoded += Base58::alphabet[*i];
+	}
+	return encoded;
+}
+
+} // namespace
+
+class Base58Test : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		std::vector<std::size_t> sizes = sizeRange(80);
+		sizes.push_back(1000);
+		for (auto &data : makeRandomData(58, sizes))
+		{
+			const std::size_t size = data.size();
+			randomData.push_back(data);
+			// leading zero bytes
+			if (size > 2 && size < 80)
+			{
+				std::fill(data.begin(), data.begin() + size % 4, std::uint8_t{ 0 });
+				randomData.push_back(std::move(data));
+			}
+		}
+		randomData.emplace_back(5, 0);
+		randomData.emplace_back(40, 0xFF);
+	}
+
+protected:
+	Base58 coder;
+	std::vector<std::vector<std::uint8_t>> randomData;
+};
+
+TEST_F(Base58Test, Known)
+{
+	const std::vector<std::pair<std::string, std::string>> vectors = {
+		{ "", "" }
+		, { std::string(1, '\0'), "1" }
+		, { "Hello World!", "2NEpo7TZRRrLZSi2U" }
+		, { "The quick brown fox jumps over the lazy dog."
+				, "USm3fpXnKG5EUBx2ndxBDMPVciP5hGey2Jh4NDv6gmeo1LkMeiKrLJUUBk6Z" }
+		, { std::string("\0\0\x28\x7f\xb4\xcd", 6), "11233QC4" } };
+	for (const auto &[decoded, expected] : vectors)
+	{
+		std::string encoded;
+		coder.encode(decoded, std::back_inserter(encoded));
+		ASSERT_EQ(expected, encoded);
+		ASSERT_EQ(expected.size(), coder.encodeSize(decoded));
+
+		std::string back;
+		coder.decode(encoded, std::back_inserter(back));
+		ASSERT_EQ(decoded, back);
+		ASSERT_EQ(decoded.size(), coder.decodeSize(encoded));
+	}
+}
+
+TEST_F(Base58Test, MatchesNaive)
+{
+	for (const auto &data : randomData)
+	{
+		const std::string expected = naiveEncode(data);
+		std::string encoded(Base58::upperBoundEncodeSize(data.size()), '\0');
+		encoded.resize(coder.encode(data.data(), data.size(), encoded.data()));
+		ASSERT_EQ(expected, encoded);
+
+		std::vector<std::uint8_t> decoded(Base58::upperBoundDecodeSize(encoded.size()));
+		const DecodeResult result = coder.decodeChecked(encoded.data(), encoded.size()
+				, decoded.data());
+		ASSERT_TRUE(result);
+		ASSERT_EQ(encoded.size(), result.errorOffset);
+		decoded.resize(result.written);
+		ASSERT_EQ(data, decoded);
+	}
+}
+
+TEST_F(Base58Test, Iterators)
+{
+	const auto &data = randomData.back();
+	const std::list<std::uint8_t> list(data.begin(), data.end());
+	std::string encoded;
+	coder.encode(list, std::back_inserter(encoded));
+	ASSERT_EQ(naiveEncode(data), encoded);
+	ASSERT_EQ(encoded.size(), coder.encodeSize(list));
+
+	const std::list<char> encodedList(encoded.begin(), encoded.end());
+	std::vector<std::uint8_t> decoded;
+	coder.decode(encodedList, std::back_inserter(decoded));
+	ASSERT_EQ(data, decoded);
+	ASSERT_EQ(data.size(), coder.decodeSize(encodedList));
+}
+
+TEST_F(Base58Test, Invalid)
+{
+	for (const char *input : { "0", "12O4", "abcl", "2NEpo7TZRRrLZSi2U+" })
+	{
+		const std::string encoded = input;
+		const DecodeResult result = coder.validate(encoded.data(), encoded.size());
+		ASSERT_EQ(DecodeStatus::InvalidCharacter, result.status);
+		ASSERT_EQ(encoded.find_first_of("0OIl+"), result.errorOffset);
+	}
+}
+
+TEST(Base58FlickrTest, Known)
+{
+	std::string encoded;
+	Base58Flickr{}.encode(std::string("Hello World!"), std::back_inserter(encoded));
+	// the same digits as Bitcoin alphabet with swapped case of letters
+	ASSERT_EQ("2nePN7syqqRkyrH2t", encoded);
+}
+
+}
+}
@@ -2,6 +2,8 @@
 
 #include <BaseCoder/BaseCoder.hpp>
 
+#include <list>
+
 namespace base_coder
 {
 namespace test
@@ -84,5 +86,63 @@ TEST_F(Base64CoderTest, DecodeRfc)
 	}
 }
 
+TEST_F(Base64CoderTest, ReverseAlphabet)
+{
+	for (size_t i = 0; i != coder.alphabetSize; ++i)
+	{
+		ASSERT_EQ(i, coder.reverseAlphabet[static_cast<uint8_t>(coder.alphabet[i])]);
+	}
+	ASSERT_EQ(Base64Traits::padIndex
+			, coder.reverseAlphabet[static_cast<uint8_t>(coder.pad)]);
+	ASSERT_EQ(Base64Traits::invalidIndex, coder.reverseAlphabet['-']);
+	ASSERT_EQ(Base64Traits::invalidIndex, coder.reverseAlphabet[0]);
+	ASSERT_EQ(Base64Traits::invalidIndex, coder.reverseAlphabet[0xFF]);
+}
+
+TEST_F(Base64CoderTest, EncodeZeroBytes)
+{
+	const std::vector<std::pair<std::string, std::string>> data = {
+			{ std::string(1, '\0'), "AA==" }
+			, { std::string(2, '\0'), "AAA=" }
+			, { std::string(3, '\0'), "AAAA" }
+			, { std::string("\0\0\0\0f", 5), "AAAAAGY=" }
+	};
+	for (const auto &[input, expected] : data)
+	{
+		std::string out;
+		coder.encode(input, std::back_inserter(out));
+		ASSERT_EQ(expected, out);
+	}
+}
+
+TEST_F(Base64CoderTest, DecodeSizeNotRandomAccess)
+{
+	for (size_t i = 0; i != refereceData.size(); ++i)
+	{
+		const std::list<char> encoded(refereceEncodedDataBase64[i].begin()
+				, refereceEncodedDataBase64[i].end());
+		ASSERT_EQ(refereceData[i].length(), coder.decodeSize(encoded));
+	}
+}
+
+TEST_F(Base64CoderTest, DecodeSizeUnpadded)
+{
+	ASSERT_EQ(1, coder.decodeSize(std::string("Zg")));
+	ASSERT_EQ(2, coder.decodeSize(std::string("Zm8")));
+	ASSERT_EQ(4, coder.decodeSize(std::string("Zm9vYg")));
+	ASSERT_EQ(3, coder.decodeSize(std::string("AAAA")));
+}
+
+TEST_F(Base64CoderTest, UpperBoundDecodeSize)
+{
+	static_assert(Base64::upperBoundDecodeSize(0) == 0);
+	static_assert(Base64::upperBoundDecodeSize(4) == 3);
+	static_assert(Base64::upperBoundDecodeSize(6) == 4);
+	for (const auto &encoded : refereceEncodedDataBase64)
+	{
+		ASSERT_LE(coder.decodeSize(encoded), coder.upperBoundDecodeSize(encoded.size()));
+	}
+}
+
 }
 }
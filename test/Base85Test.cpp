@@ -0,0 +1,186 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/Base85.hpp>
+
+#include <list>
+
+namespace base_coder
+{
+namespace test
+{
+
+namespace
+{
+
+///
+/// \brief naiveEncode: digit-by-digit division, reference for random data
+///
+template<typename Coder>
+std::string naiveEncode(const std::vector<std::uint8_t> &data)
+{
+	std::string encoded;
+	for (std::size_t position = 0; position < data.size(); position += 4)
+	{
+		const std::size_t count = std::min<std::size_t>(4, data.size() - position);
+		std::uint32_t value = 0;
+		for (std::size_t i = 0; i != 4; ++i)
+		{
+			value = (value << 8) | (i < count ? data[position + i] : 0);
+		}
+		if (Coder::zeroGroup != 0 && count == 4 && value == 0)
+		{
+			encoded += Coder::zeroGroup;
+			continue;
+		}
+		char group[5];
+		for (std::size_t i = 5; i-- != 0; value /= 85)
+		{
+			group[i] = Coder::alphabet[value % 85];
+		}
+		encoded.append(group, count + 1);
+	}
+	return encoded;
+}
+
+} // namespace
+
+template<typename Coder>
+class Base85Test : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		for (auto &data : makeRandomData(85
+				, { 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 32, 33, 100, 1000, 5003 }))
+		{
+			randomData.push_back(data);
+			// zero groups between vectors
+			if (data.size() >= 100)
+			{
+				std::fill(data.begin() + 8, data.begin() + 12, std::uint8_t{ 0 });
+				std::fill(data.begin() + 60, data.begin() + 64, std::uint8_t{ 0 });
+				std::fill(data.end() - 8, data.end() - 4, std::uint8_t{ 0 });
+				randomData.push_back(std::move(data));
+			}
+		}
+		randomData.emplace_back(400, 0);
+		randomData.emplace_back(400, 0xFF);
+	}
+
+protected:
+	Coder coder;
+	std::vector<std::vector<std::uint8_t>> randomData;
+};
+
+using Base85Coders = ::testing::Types<Ascii85, Z85>;
+TYPED_TEST_SUITE(Base85Test, Base85Coders);
+
+TYPED_TEST(Base85Test, RoundTrip)
+{
+	forEachLevel([&]()
+	{
+		for (const auto &data : this->randomData)
+		{
+			const std::string expected = naiveEncode<TypeParam>(data);
+			std::string encoded(TypeParam::upperBoundEncodeSize(data.size()), '\0');
+			encoded.resize(this->coder.encode(data.data(), data.size(), encoded.data()));
+			ASSERT_EQ(expected, encoded);
+			ASSERT_EQ(expected.size(), this->coder.encodeSize(data));
+
+			std::vector<std::uint8_t> decoded(TypeParam::upperBoundDecodeSize(encoded.size()));
+			const DecodeResult result = this->coder.decodeChecked(encoded.data()
+					, encoded.size(), decoded.data());
+			ASSERT_TRUE(result);
+			ASSERT_EQ(encoded.size(), result.errorOffset);
+			decoded.resize(result.written);
+			ASSERT_EQ(data, decoded);
+			ASSERT_EQ(data.size(), this->coder.decodeSize(encoded));
+		}
+	});
+}
+
+TYPED_TEST(Base85Test, Iterators)
+{
+	const auto &data = this->randomData[this->randomData.size() - 3];
+	const std::list<std::uint8_t> list(data.begin(), data.end());
+	std::string encoded;
+	this->coder.encode(list, std::back_inserter(encoded));
+	ASSERT_EQ(naiveEncode<TypeParam>(data), encoded);
+	ASSERT_EQ(encoded.size(), this->coder.encodeSize(list));
+
+	const std::list<char> encodedList(encoded.begin(), encoded.end());
+	std::vector<std::uint8_t> decoded;
+	this->coder.decode(encodedList, std::back_inserter(decoded));
+	ASSERT_EQ(data, decoded);
+	ASSERT_EQ(data.size(), this->coder.decodeSize(encodedList));
+
+	std::vector<std::uint8_t> fromString;
+	this->coder.decode(encoded, std::back_inserter(fromString));
+	ASSERT_EQ(data, fromString);
+}
+
+TYPED_TEST(Base85Test, InvalidCharacter)
+{
+	const std::string valid = naiveEncode<TypeParam>(this->randomData[this->randomData.size() - 4]);
+	forEachLevel([&]()
+	{
+		for (size_t offset : { size_t{ 0 }, size_t{ 3 }, size_t{ 101 }, valid.size() - 2 })
+		{
+			for (char character : { ' ', '~', '\x80', '\0' })
+			{
+				std::string input = valid;
+				input[offset] = character;
+				const DecodeResult result = this->coder.validate(input.data(), input.size());
+				ASSERT_EQ(DecodeStatus::InvalidCharacter, result.status);
+				ASSERT_EQ(offset, result.errorOffset);
+			}
+		}
+	});
+}
+
+TYPED_TEST(Base85Test, Overflow)
+{
+	// the largest group is 2^32 - 1, the next value is invalid at start of group
+	std::string input = naiveEncode<TypeParam>(std::vector<std::uint8_t>(40, 0xFF));
+	input.replace(20, 5, 5, TypeParam::alphabet[84]);
+	forEachLevel({ SimdLevel::Scalar, SimdLevel::Avx2 }, [&]()
+	{
+		const DecodeResult result = this->coder.validate(input.data(), input.size());
+		ASSERT_EQ(DecodeStatus::InvalidCharacter, result.status);
+		ASSERT_EQ(20, result.errorOffset);
+		ASSERT_EQ(16, result.written);
+	});
+
+	const DecodeResult length = this->coder.validate(input.data(), 21);
+	ASSERT_EQ(DecodeStatus::InvalidLength, length.status);
+	ASSERT_EQ(20, length.errorOffset);
+}
+
+TEST(Base85Test, Known)
+{
+	std::string ascii85;
+	Ascii85{}.encode(std::string_view("Man is distinguished"), std::back_inserter(ascii85));
+	ASSERT_EQ("9jqo^BlbD-BleB1DJ+*+F(f,q", ascii85);
+
+	std::string tail;
+	Ascii85{}.encode(std::string_view("sure."), std::back_inserter(tail));
+	ASSERT_EQ("F*2M7/c", tail);
+
+	std::string zeros;
+	Ascii85{}.encode(std::string("\0\0\0\0\0\0\0\0ab", 10), std::back_inserter(zeros));
+	ASSERT_EQ("zz@:B", zeros);
+
+	// RFC 32
+	std::string z85;
+	Z85{}.encode(std::vector<std::uint8_t>{ 0x86, 0x4F, 0xD2, 0x6F, 0xB5, 0x59, 0xF7, 0x5B }
+			, std::back_inserter(z85));
+	ASSERT_EQ("HelloWorld", z85);
+
+	// zero group inside of group
+	const DecodeResult result = Ascii85{}.validate("9jqzo", 5);
+	ASSERT_EQ(DecodeStatus::InvalidCharacter, result.status);
+	ASSERT_EQ(3, result.errorOffset);
+}
+
+}
+}
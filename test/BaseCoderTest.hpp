@@ -1,8 +1,16 @@
 #ifndef BASECODER_TEST_HPP
 #define BASECODER_TEST_HPP
 
+#include <BaseCoder/Cpu.hpp>
+
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <initializer_list>
+#include <random>
+#include <string>
+#include <vector>
+
 namespace std
 {
 
@@ -40,6 +48,97 @@ namespace base_coder
 namespace test
 {
 
+///
+/// \brief makeRandomData
+/// \tparam Container of bytes
+/// \param seed
+/// \param sizes
+/// \return containers of sizes, filled by one generator in order of sizes
+///
+template<typename Container = std::vector<std::uint8_t>>
+std::vector<Container> makeRandomData(unsigned seed, const std::vector<std::size_t> &sizes)
+{
+	std::mt19937 generator(seed);
+	std::vector<Container> result;
+	for (std::size_t size : sizes)
+	{
+		Container data(size, 0);
+		for (auto &i : data)
+		{
+			i = static_cast<typename Container::value_type>(generator());
+		}
+		result.push_back(std::move(data));
+	}
+	return result;
+}
+
+///
+/// \brief sizeRange
+/// \param end
+/// \return sizes from 0 to end - 1
+///
+inline std::vector<std::size_t> sizeRange(std::size_t end)
+{
+	std::vector<std::size_t> sizes(end);
+	for (std::size_t i = 0; i != end; ++i)
+	{
+		sizes[i] = i;
+	}
+	return sizes;
+}
+
+///
+/// \brief The SimdLevelGuard class: restores detected SIMD level on destruction, also
+/// when a failed assertion returns early
+///
+class SimdLevelGuard
+{
+public:
+	SimdLevelGuard() = default;
+	SimdLevelGuard(const SimdLevelGuard &) = delete;
+	SimdLevelGuard &operator=(const SimdLevelGuard &) = delete;
+
+	~SimdLevelGuard()
+	{
+		setSimdLevel(detectSimdLevel());
+	}
+};
+
+///
+/// \brief forEachLevel: call callable with each supported level of levels selected,
+/// stops at the first fatal failure
+/// \param levels
+/// \param callable
+///
+template<typename Callable>
+void forEachLevel(std::initializer_list<SimdLevel> levels, Callable &&callable)
+{
+	const SimdLevelGuard guard;
+	for (auto level : levels)
+	{
+		if (setSimdLevel(level))
+		{
+			SCOPED_TRACE(static_cast<int>(level));
+			callable();
+			if (::testing::Test::HasFatalFailure())
+			{
+				return;
+			}
+		}
+	}
+}
+
+///
+/// \brief forEachLevel: call callable with each supported level selected
+/// \param callable
+///
+template<typename Callable>
+void forEachLevel(Callable &&callable)
+{
+	forEachLevel({ SimdLevel::Scalar, SimdLevel::Ssse3, SimdLevel::Avx2, SimdLevel::Avx512
+			, SimdLevel::Avx512Vbmi }, callable);
+}
+
 class BaseCoderTest : public ::testing::Test
 {
 protected:
@@ -0,0 +1,104 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/Batch.hpp>
+
+#include <random>
+
+namespace base_coder
+{
+namespace test
+{
+
+template<typename Trait>
+class BatchCoderTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		std::mt19937 generator(5);
+		for (size_t i = 0; i != 200; ++i)
+		{
+			std::string token(generator() % 80, '\0');
+			for (auto &c : token)
+			{
+				c = static_cast<char>(generator());
+			}
+			tokens.push_back(std::move(token));
+		}
+
+		// adjacent tokens of one buffer
+		buffer.resize(48 * 20 + 17);
+		for (auto &c : buffer)
+		{
+			c = static_cast<char>(generator());
+		}
+		for (size_t position = 0; position < buffer.size(); )
+		{
+			const size_t size = std::min<size_t>(buffer.size() - position
+					, (position / 48 % 3) ? 48 : 15);
+			slices.push_back(std::string_view(buffer).substr(position, size));
+			position += size;
+		}
+	}
+
+	template<typename Inputs>
+	void checkRoundTrip(const Inputs &inputs)
+	{
+		std::string encoded(encodeBatchSize<Trait>(inputs), '\0');
+		std::vector<size_t> offsets(inputs.size() + 1);
+		ASSERT_EQ(encoded.size(), encodeBatch<Trait>(inputs, encoded.data()
+				, offsets.data()));
+
+		std::vector<std::string_view> encodedInputs;
+		for (size_t i = 0; i != inputs.size(); ++i)
+		{
+			std::string expected;
+			coder.encode(inputs[i], std::back_inserter(expected));
+			const std::string_view out = std::string_view(encoded).substr(offsets[i]
+					, offsets[i + 1] - offsets[i]);
+			ASSERT_EQ(std::string_view(expected), out);
+			encodedInputs.push_back(out);
+		}
+
+		std::vector<std::uint8_t> decoded(decodeBatchSize<Trait>(encodedInputs));
+		std::vector<size_t> decodedOffsets(inputs.size() + 1);
+		ASSERT_EQ(decoded.size(), decodeBatch<Trait>(encodedInputs, decoded.data()
+				, decodedOffsets.data()));
+		for (size_t i = 0; i != inputs.size(); ++i)
+		{
+			ASSERT_EQ(inputs[i].size(), decodedOffsets[i + 1] - decodedOffsets[i]);
+			ASSERT_TRUE(std::equal(inputs[i].begin(), inputs[i].end()
+					, reinterpret_cast<const char *>(decoded.data()) + decodedOffsets[i]));
+		}
+	}
+
+protected:
+	BaseCoder<Trait> coder;
+	std::vector<std::string> tokens;
+	std::string buffer;
+	std::vector<std::string_view> slices;
+};
+
+using Traits = ::testing::Types<Base64Traits, Base32Traits, Base16Traits>;
+TYPED_TEST_SUITE(BatchCoderTest, Traits);
+
+TYPED_TEST(BatchCoderTest, Separate)
+{
+	this->checkRoundTrip(this->tokens);
+}
+
+TYPED_TEST(BatchCoderTest, Adjacent)
+{
+	this->checkRoundTrip(this->slices);
+}
+
+TYPED_TEST(BatchCoderTest, Empty)
+{
+	const std::vector<std::string> inputs;
+	size_t offset = 1;
+	ASSERT_EQ(0, encodeBatch<TypeParam>(inputs, nullptr, &offset));
+	ASSERT_EQ(0, offset);
+}
+
+}
+}
@@ -0,0 +1,167 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/BaseCoder.hpp>
+
+#include <list>
+#include <random>
+
+namespace base_coder
+{
+namespace test
+{
+
+template<typename Coder>
+class ContiguousCoderTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		randomData = makeRandomData(7, sizeRange(100));
+		randomData.emplace_back(5000, 0);
+	}
+
+protected:
+	Coder coder;
+	std::vector<std::vector<std::uint8_t>> randomData;
+};
+
+using Coders = ::testing::Types<Base64, Base64Hex, Base32, Base32Hex, Base16, Base16Lower>;
+TYPED_TEST_SUITE(ContiguousCoderTest, Coders);
+
+TYPED_TEST(ContiguousCoderTest, EncodeMatchesIterators)
+{
+	for (const auto &data : this->randomData)
+	{
+		const std::list<std::uint8_t> list(data.begin(), data.end());
+		std::string expected;
+		this->coder.encode(list, std::back_inserter(expected));
+
+		std::string fromVector;
+		this->coder.encode(data, std::back_inserter(fromVector));
+		ASSERT_EQ(expected, fromVector);
+
+		std::string out(this->coder.encodeSize(data), '\0');
+		const size_t written = this->coder.encode(data.data(), data.size(), out.data());
+		ASSERT_EQ(out.size(), written);
+		ASSERT_EQ(expected, out);
+	}
+}
+
+TYPED_TEST(ContiguousCoderTest, DecodeRoundTrip)
+{
+	for (const auto &data : this->randomData)
+	{
+		std::string encoded;
+		this->coder.encode(data, std::back_inserter(encoded));
+
+		std::vector<std::uint8_t> out(data.size());
+		const size_t written = this->coder.decode(encoded.data(), encoded.size()
+				, out.data());
+		ASSERT_EQ(data.size(), written);
+		ASSERT_EQ(data, out);
+	}
+}
+
+TYPED_TEST(ContiguousCoderTest, DecodeMatchesIterators)
+{
+	for (const auto &data : this->randomData)
+	{
+		std::string encoded;
+		this->coder.encode(data, std::back_inserter(encoded));
+
+		const std::list<char> list(encoded.begin(), encoded.end());
+		std::string expected;
+		this->coder.decode(list, std::back_inserter(expected));
+
+		std::string fromString;
+		this->coder.decode(encoded, std::back_inserter(fromString));
+		ASSERT_EQ(expected, fromString);
+	}
+}
+
+TYPED_TEST(ContiguousCoderTest, IteratorDecodeKeepsZeroBytes)
+{
+	// sizes around staging buffer of 256 blocks
+	const size_t stagingSize = 256 * TypeParam::inputBufferSize;
+	std::mt19937 generator(13);
+	for (size_t size : { size_t{ 1 }, size_t{ 2 }, size_t{ 3 }, size_t{ 17 }
+			, stagingSize - 1, stagingSize, stagingSize + 1, 3 * stagingSize + 2 })
+	{
+		std::vector<std::uint8_t> data(size);
+		for (size_t i = 0; i != size; ++i)
+		{
+			data[i] = (i % 3 == 0 || i + 1 == size)
+					? 0 : static_cast<std::uint8_t>(generator());
+		}
+		std::string encoded;
+		this->coder.encode(data, std::back_inserter(encoded));
+
+		std::vector<std::uint8_t> fromString;
+		this->coder.decode(encoded, std::back_inserter(fromString));
+		ASSERT_EQ(data, fromString);
+
+		const std::list<char> list(encoded.begin(), encoded.end());
+		std::vector<std::uint8_t> fromList;
+		this->coder.decode(list, std::back_inserter(fromList));
+		ASSERT_EQ(data, fromList);
+
+		std::vector<std::uint8_t> fromPointer(this->coder.decodeSize(encoded));
+		this->coder.decode(encoded, fromPointer.data());
+		ASSERT_EQ(data, fromPointer);
+	}
+}
+
+TYPED_TEST(ContiguousCoderTest, DecodeInPlace)
+{
+	auto dataSet = this->randomData;
+	dataSet.push_back(makeRandomData(37, { 5000 }).front());
+
+	forEachLevel([&]()
+	{
+		for (const auto &data : dataSet)
+		{
+			std::string encoded;
+			this->coder.encode(data, std::back_inserter(encoded));
+
+			std::string buffer = encoded;
+			const size_t written = this->coder.decodeInPlace(buffer.data(), buffer.size());
+			ASSERT_EQ(data.size(), written);
+			ASSERT_TRUE(std::equal(data.begin(), data.end(), buffer.begin()
+					, [](std::uint8_t a, char b) { return a == static_cast<std::uint8_t>(b); }));
+
+			buffer = encoded;
+			const DecodeResult result = this->coder.decodeChecked(buffer.data()
+					, buffer.size(), reinterpret_cast<std::uint8_t *>(buffer.data()));
+			ASSERT_TRUE(result);
+			ASSERT_EQ(data.size(), result.written);
+			ASSERT_TRUE(std::equal(data.begin(), data.end(), buffer.begin()
+					, [](std::uint8_t a, char b) { return a == static_cast<std::uint8_t>(b); }));
+		}
+	});
+}
+
+#if defined(__cpp_lib_span)
+TYPED_TEST(ContiguousCoderTest, Span)
+{
+	for (const auto &data : this->randomData)
+	{
+		std::string encoded(this->coder.encodeSize(data), '\0');
+		ASSERT_EQ(encoded.size(), this->coder.encode(
+				std::as_bytes(std::span(data)), std::span(encoded)));
+
+		std::vector<std::byte> decoded(data.size());
+		ASSERT_EQ(data.size(), this->coder.decode(
+				std::span<const char>(encoded), std::span(decoded)));
+		ASSERT_TRUE(std::equal(data.begin(), data.end(), decoded.begin()
+				, [](auto a, auto b) { return std::byte{ a } == b; }));
+
+		std::span<char> inPlace(encoded);
+		inPlace = inPlace.first(this->coder.decodeInPlace(inPlace));
+		ASSERT_TRUE(std::equal(data.begin(), data.end(), inPlace.begin()
+				, inPlace.end(), [](auto a, auto b) { return a == static_cast<std::uint8_t>(b); }));
+	}
+}
+#endif
+
+}
+}
@@ -0,0 +1,183 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/BaseCoder.hpp>
+#include <BaseCoder/Transcode.hpp>
+
+#include <cctype>
+
+namespace base_coder
+{
+namespace test
+{
+
+namespace
+{
+
+using Base16Custom = BaseCoder<CustomTraits<"0123456789abcdef">>;
+
+static_assert(Base64Bcrypt::type == Type::Base64);
+static_assert(Base32Crockford::indexBitSize == 5 && Base32Crockford::inputBufferSize == 5);
+static_assert(Base16Custom::type == Type::Base16 && Base16Custom::padding == Padding::Optional);
+static_assert(detail::isUniqueAlphabet("ABC", 3, '='));
+static_assert(!detail::isUniqueAlphabet("ABA", 3, '='));
+static_assert(!detail::isUniqueAlphabet("AB=", 3, '='));
+static_assert(detail::alphabetBitSize(20) == 0);
+
+// characters of standard alphabet of the same type with the same indices
+template<typename Coder>
+using StandardCoder = BaseCoder<Traits<Coder::type, Subtype::Common, Coder::padding>>;
+
+} // namespace
+
+template<typename Coder>
+class CustomTraitsTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		randomData = makeRandomData(53, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 31, 100, 1000, 5000 });
+	}
+
+	///
+	/// \brief expectedEncode: encoding by standard alphabet and mapping of characters
+	///
+	static std::string expectedEncode(const std::vector<std::uint8_t> &data)
+	{
+		using Standard = StandardCoder<Coder>;
+
+		std::string encoded;
+		Standard{}.encode(data, std::back_inserter(encoded));
+		for (auto &i : encoded)
+		{
+			if (i != Standard::pad)
+			{
+				i = Coder::alphabet[Standard::reverseAlphabet[static_cast<std::uint8_t>(i)]];
+			}
+		}
+		return encoded;
+	}
+
+protected:
+	Coder coder;
+	std::vector<std::vector<std::uint8_t>> randomData;
+};
+
+using CustomCoders = ::testing::Types<Base32Crockford, ZBase32, Base64Bcrypt, Base64Imap
+		, Base16Custom>;
+TYPED_TEST_SUITE(CustomTraitsTest, CustomCoders);
+
+TYPED_TEST(CustomTraitsTest, RoundTrip)
+{
+	forEachLevel([&]()
+	{
+		for (const auto &data : this->randomData)
+		{
+			const std::string expected = this->expectedEncode(data);
+			std::string encoded(this->coder.encodeSize(data), '\0');
+			ASSERT_EQ(expected.size(), this->coder.encode(data.data(), data.size()
+					, encoded.data()));
+			ASSERT_EQ(expected, encoded);
+
+			std::vector<std::uint8_t> decoded(data.size());
+			const DecodeResult result = this->coder.decodeChecked(encoded.data()
+					, encoded.size(), decoded.data());
+			ASSERT_TRUE(result);
+			ASSERT_EQ(data, decoded);
+		}
+	});
+}
+
+TYPED_TEST(CustomTraitsTest, InvalidCharacter)
+{
+	const std::string valid = this->expectedEncode(this->randomData.back());
+	// characters of standard alphabet which aren't in the custom one
+	std::string foreign;
+	for (const char *i = StandardCoder<TypeParam>::alphabet; *i; ++i)
+	{
+		if (TypeParam::reverseAlphabet[static_cast<std::uint8_t>(*i)] == detail::invalidIndex)
+		{
+			foreign += *i;
+		}
+	}
+	foreign += '\x80';
+
+	forEachLevel([&]()
+	{
+		for (size_t offset : { size_t{ 0 }, size_t{ 100 }, valid.size() - 3 })
+		{
+			for (char character : foreign)
+			{
+				std::string input = valid;
+				input[offset] = character;
+				const DecodeResult result = this->coder.validate(input.data(), input.size());
+				ASSERT_EQ(DecodeStatus::InvalidCharacter, result.status);
+				ASSERT_EQ(offset, result.errorOffset);
+			}
+		}
+	});
+}
+
+TEST(CustomTraitsTest, KnownAlphabets)
+{
+	std::string crockford;
+	Base32Crockford{}.encode(std::string_view("foobar"), std::back_inserter(crockford));
+	ASSERT_EQ("CSQPYRK1E8", crockford);
+
+	std::string imap;
+	Base64Imap{}.encode(std::vector<std::uint8_t>{ 0xFB, 0xFF, 0xBF }, std::back_inserter(imap));
+	ASSERT_EQ("+,+,", imap);
+
+	std::string bcrypt;
+	Base64Bcrypt{}.encode(std::vector<std::uint8_t>{ 0, 0, 0, 0xFF }, std::back_inserter(bcrypt));
+	ASSERT_EQ("....9u", bcrypt);
+
+	// custom Base16 alphabet is case-sensitive
+	ASSERT_TRUE(Base16Custom{}.validate("00ff", 4));
+	ASSERT_FALSE(Base16Custom{}.validate("00FF", 4));
+}
+
+TEST(CustomTraitsTest, CrockfordAliases)
+{
+	std::string decoded;
+	Base32Crockford{}.decode(std::string_view("csqpyrkie8"), std::back_inserter(decoded));
+	ASSERT_EQ("foobar", decoded);
+
+	const auto data = makeRandomData(1, { 5000 }).front();
+	std::string encoded;
+	Base32Crockford{}.encode(data, std::back_inserter(encoded));
+	// lowercase letters and aliases of '0' and '1' in turn
+	const char zeros[] = "Oo0";
+	const char ones[] = "IiLl1";
+	std::size_t count = 0;
+	for (auto &i : encoded)
+	{
+		i = (i == '0') ? zeros[count++ % 3] : (i == '1') ? ones[count++ % 5]
+				: static_cast<char>(std::tolower(static_cast<unsigned char>(i)));
+	}
+
+	forEachLevel([&]()
+	{
+		std::vector<std::uint8_t> output(data.size());
+		const DecodeResult result = Base32Crockford{}.decodeChecked(encoded.data()
+				, encoded.size(), output.data());
+		ASSERT_TRUE(result);
+		ASSERT_EQ(data, output);
+	});
+
+	ASSERT_FALSE(Base32Crockford{}.validate("U0000000", 8));
+}
+
+TEST(CustomTraitsTest, Transcode)
+{
+	const std::string input = "Zm9vYmFy+/8=";
+	std::string output(upperBoundTranscodeSize<Base64Traits, Base64ImapTraits>(input.size())
+			, '\0');
+	const DecodeResult result = transcode<Base64Traits, Base64ImapTraits>(input.data()
+			, input.size(), output.data());
+	ASSERT_TRUE(result);
+	output.resize(result.written);
+	ASSERT_EQ("Zm9vYmFy+,8", output);
+}
+
+}
+}
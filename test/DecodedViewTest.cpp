@@ -0,0 +1,126 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/DecodedView.hpp>
+
+#include <algorithm>
+#include <deque>
+
+namespace base_coder
+{
+namespace test
+{
+
+template<typename Coder>
+class DecodedViewTest : public ::testing::Test
+{
+protected:
+	using Trait = Traits<Coder::type, Coder::subtype>;
+
+	void SetUp() override
+	{
+		randomData = makeRandomData(19, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 100, 3000 });
+	}
+
+	std::string encode(const std::vector<std::uint8_t> &data) const
+	{
+		std::string encoded;
+		coder.encode(data, std::back_inserter(encoded));
+		return encoded;
+	}
+
+protected:
+	Coder coder;
+	std::vector<std::vector<std::uint8_t>> randomData;
+};
+
+using Coders = ::testing::Types<Base64, Base64Hex, Base32, Base32Hex, Base16>;
+TYPED_TEST_SUITE(DecodedViewTest, Coders);
+
+TYPED_TEST(DecodedViewTest, RandomAccess)
+{
+	using Trait = typename TestFixture::Trait;
+
+	for (const auto &data : this->randomData)
+	{
+		const std::string encoded = this->encode(data);
+		const auto view = makeDecodedView<Trait>(encoded);
+		ASSERT_EQ(data.size(), view.size());
+		for (size_t i = data.size(); i-- != 0; )
+		{
+			ASSERT_EQ(data[i], view[i]);
+		}
+		ASSERT_EQ(data, std::vector<std::uint8_t>(view.begin(), view.end()));
+		ASSERT_EQ(static_cast<std::ptrdiff_t>(data.size()), view.end() - view.begin());
+		if (!data.empty())
+		{
+			ASSERT_EQ(data.back(), *(view.end() - 1));
+			ASSERT_EQ(data[data.size() / 2], view.begin()[data.size() / 2]);
+		}
+		ASSERT_THROW(view.at(data.size()), std::out_of_range);
+	}
+}
+
+TYPED_TEST(DecodedViewTest, NotContiguous)
+{
+	using Trait = typename TestFixture::Trait;
+
+	const auto &data = this->randomData.back();
+	const std::string encoded = this->encode(data);
+	const std::deque<char> deque(encoded.begin(), encoded.end());
+	const auto view = makeDecodedView<Trait>(deque);
+	ASSERT_EQ(data.size(), view.size());
+	ASSERT_TRUE(std::equal(data.begin(), data.end(), view.begin(), view.end()));
+
+	std::vector<std::uint8_t> decoded;
+	view.subview(1000, 100).decode(std::back_inserter(decoded));
+	ASSERT_TRUE(std::equal(decoded.begin(), decoded.end(), data.begin() + 1000));
+}
+
+TYPED_TEST(DecodedViewTest, Subview)
+{
+	using Trait = typename TestFixture::Trait;
+
+	for (const auto &data : this->randomData)
+	{
+		const std::string encoded = this->encode(data);
+		const auto view = makeDecodedView<Trait>(encoded);
+		for (size_t offset = 0; offset <= data.size(); offset += 1 + offset / 3)
+		{
+			for (size_t length : { size_t{ 0 }, size_t{ 1 }, size_t{ 2 }, size_t{ 7 }
+					, size_t{ 2000 }, data.size() })
+			{
+				const auto subview = view.subview(offset, length);
+				const size_t expectedSize = std::min(length, data.size() - offset);
+				ASSERT_EQ(expectedSize, subview.size());
+
+				const std::vector<std::uint8_t> expected(data.begin() + offset
+						, data.begin() + offset + expectedSize);
+				std::vector<std::uint8_t> decoded;
+				subview.decode(std::back_inserter(decoded));
+				ASSERT_EQ(expected, decoded);
+				ASSERT_EQ(expected
+						, std::vector<std::uint8_t>(subview.begin(), subview.end()));
+				if (expectedSize)
+				{
+					ASSERT_EQ(expected.front(), subview[0]);
+					ASSERT_EQ(expected.back(), subview.subview(expectedSize - 1)[0]);
+				}
+			}
+		}
+		ASSERT_THROW(view.subview(data.size() + 1), std::out_of_range);
+	}
+}
+
+TEST(DecodedViewTest, ReadHeader)
+{
+	// only the first block of the broken payload is decoded
+	std::string encoded = "SGVhZGVy";
+	encoded.append(1 << 20, '*');
+	const auto view = makeDecodedView<Base64Traits>(encoded);
+	std::string header;
+	view.subview(0, 6).decode(std::back_inserter(header));
+	ASSERT_EQ("Header", header);
+}
+
+}
+}
@@ -0,0 +1,180 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/Lines.hpp>
+
+#include <random>
+
+namespace base_coder
+{
+namespace test
+{
+
+template<typename Coder>
+class LinesTest : public ::testing::Test
+{
+protected:
+	using Trait = Traits<Coder::type, Coder::subtype>;
+
+	void SetUp() override
+	{
+		randomData = makeRandomData(23, { 0, 1, 2, 3, 4, 5, 56, 57, 58, 100, 5000, 20000 });
+	}
+
+	std::string encode(const std::vector<std::uint8_t> &data) const
+	{
+		std::string encoded;
+		coder.encode(data, std::back_inserter(encoded));
+		return encoded;
+	}
+
+	///
+	/// \brief breakLines: reference line breaking of encoded data
+	///
+	static std::string breakLines(const std::string &encoded, const LineOptions &options)
+	{
+		std::string result;
+		for (size_t position = 0; position < encoded.size(); position += options.length)
+		{
+			if (position)
+			{
+				result += options.separator;
+			}
+			result += encoded.substr(position, options.length);
+		}
+		return result;
+	}
+
+	DecodeResult decode(const LineCoder<Trait> &lineCoder, const std::string &encoded
+			, std::vector<std::uint8_t> &out) const
+	{
+		out.assign(lineCoder.upperBoundDecodeSize(encoded.size()), 0);
+		const DecodeResult result = lineCoder.decode(encoded.data(), encoded.size()
+				, out.data());
+		out.resize(result.written);
+		return result;
+	}
+
+protected:
+	Coder coder;
+	std::vector<std::vector<std::uint8_t>> randomData;
+};
+
+using Coders = ::testing::Types<Base64, Base64Hex, Base32, Base32Hex, Base16>;
+TYPED_TEST_SUITE(LinesTest, Coders);
+
+TYPED_TEST(LinesTest, Encode)
+{
+	using Trait = typename TestFixture::Trait;
+
+	forEachLevel([this]()
+	{
+		for (const LineOptions &options : { mimeLines, pemLines, LineOptions{ 5, "\n" }
+				, LineOptions{ 77, " \t" }, LineOptions{ 0, "\n" } })
+		{
+			const LineCoder<Trait> lineCoder(options);
+			for (const auto &data : this->randomData)
+			{
+				const std::string expected = options.length
+						? this->breakLines(this->encode(data), options)
+						: this->encode(data);
+				ASSERT_EQ(expected.size(), lineCoder.encodeSize(data.size()));
+				std::string encoded(expected.size(), '\0');
+				ASSERT_EQ(expected.size(), lineCoder.encode(data.data(), data.size()
+						, encoded.data()));
+				ASSERT_EQ(expected, encoded);
+			}
+		}
+	});
+}
+
+TYPED_TEST(LinesTest, DecodeSkipsWhitespace)
+{
+	using Trait = typename TestFixture::Trait;
+
+	forEachLevel([this]()
+	{
+		const LineCoder<Trait> lineCoder;
+		std::mt19937 generator(29);
+		for (const auto &data : this->randomData)
+		{
+			const std::string encoded = this->encode(data);
+			std::string spaced;
+			for (char i : encoded)
+			{
+				// whitespace runs longer than vectors
+				const size_t count = (generator() % 8 == 0) ? generator() % 70 : 0;
+				for (size_t j = 0; j != count; ++j)
+				{
+					spaced.push_back(" \t\n\v\f\r"[generator() % 6]);
+				}
+				spaced.push_back(i);
+			}
+			spaced += "\r\n";
+
+			for (const std::string &input : { encoded, spaced
+					, this->breakLines(encoded, mimeLines) + "\r\n"
+					, this->breakLines(encoded, pemLines) })
+			{
+				std::vector<std::uint8_t> out;
+				const DecodeResult result = this->decode(lineCoder, input, out);
+				ASSERT_TRUE(result);
+				ASSERT_EQ(input.size(), result.errorOffset);
+				ASSERT_EQ(data, out);
+			}
+		}
+	});
+}
+
+TYPED_TEST(LinesTest, DecodeErrors)
+{
+	using Trait = typename TestFixture::Trait;
+
+	forEachLevel([this]()
+	{
+		const LineCoder<Trait> lineCoder(pemLines);
+		const std::string valid = this->breakLines(this->encode(this->randomData.back())
+				, pemLines);
+		for (size_t offset : { size_t{ 0 }, size_t{ 63 }, size_t{ 66 }, size_t{ 4100 }
+				, valid.size() - 2 })
+		{
+			ASSERT_NE('\n', valid[offset]);
+			std::string encoded = valid;
+			encoded[offset] = '*';
+			std::vector<std::uint8_t> out;
+			const DecodeResult result = this->decode(lineCoder, encoded, out);
+			ASSERT_EQ(DecodeStatus::InvalidCharacter, result.status);
+			ASSERT_EQ(offset, result.errorOffset);
+			ASSERT_TRUE(std::equal(out.begin(), out.end()
+					, this->randomData.back().begin()));
+		}
+
+		// pad followed by data, with whitespace between
+		const std::string block(Trait::indexBufferSize, Trait::alphabet[1]);
+		const std::string padded = block.substr(1) + Trait::pad + "\n\n" + block;
+		std::vector<std::uint8_t> out;
+		const DecodeResult result = this->decode(lineCoder, padded, out);
+		ASSERT_EQ(DecodeStatus::InvalidPadding, result.status);
+		ASSERT_EQ(block.size() - 1, result.errorOffset);
+
+		// pad is the last character of data if whitespace follows
+		const std::string trailing = block + this->encode({ 7 }) + std::string(5000, ' ');
+		ASSERT_TRUE(this->decode(lineCoder, trailing, out));
+	});
+}
+
+TEST(LinesTest, Pem)
+{
+	const std::string encoded = "TWFu\nIGlz\nIGRp\r\nc3Rp\n";
+	const LineCoder<Base64Traits> coder(LineOptions{ 4, "\n" });
+	std::vector<std::uint8_t> out(coder.upperBoundDecodeSize(encoded.size()));
+	const DecodeResult result = coder.decode(encoded.data(), encoded.size(), out.data());
+	ASSERT_TRUE(result);
+	ASSERT_EQ("Man is disti", std::string(out.begin(), out.begin() + result.written));
+
+	std::string lines(coder.encodeSize(result.written), '\0');
+	coder.encode(out.data(), result.written, lines.data());
+	ASSERT_EQ("TWFu\nIGlz\nIGRp\nc3Rp", lines);
+}
+
+}
+}
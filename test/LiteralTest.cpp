@@ -0,0 +1,86 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/Literal.hpp>
+
+#include <string_view>
+
+namespace base_coder
+{
+namespace test
+{
+
+namespace
+{
+
+template<typename Result>
+constexpr bool equal(const Result &result, std::string_view expected)
+{
+	if (result.size() != expected.size())
+	{
+		return false;
+	}
+	for (std::size_t i = 0; i != expected.size(); ++i)
+	{
+		if (static_cast<std::uint8_t>(result[i]) != static_cast<std::uint8_t>(expected[i]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// RFC 4648 test vectors, checked by compiler
+
+static_assert(equal(encodeLiteral<Base64>(""), ""));
+static_assert(equal(encodeLiteral<Base64>("f"), "Zg=="));
+static_assert(equal(encodeLiteral<Base64>("foobar"), "Zm9vYmFy"));
+static_assert(equal(encodeLiteral<Base32>("fooba"), "MZXW6YTB"));
+static_assert(equal(encodeLiteral<Base32Hex>("foob"), "CPNMUOG="));
+static_assert(equal(encodeLiteral<Base16>("foo"), "666F6F"));
+static_assert(equal(encodeLiteral<Base64HexUnpadded>("fo"), "Zm8"));
+
+static_assert(equal(decodeLiteral<Base64>(""), ""));
+static_assert(equal(decodeLiteral<Base64>("Zg=="), "f"));
+static_assert(equal(decodeLiteral<Base64>("Zm8"), "fo"));
+static_assert(equal(decodeLiteral<Base64>("Zm9vYmFy"), "foobar"));
+static_assert(equal(decodeLiteral<Base64Hex>("-_8="), "\xFB\xFF"));
+static_assert(equal(decodeLiteral<Base32>("MZXW6YQ="), "foob"));
+static_assert(equal(decodeLiteral<Base32Hex>("CPNMUOJ1E8======"), "foobar"));
+static_assert(equal(decodeLiteral<Base16>("666F6F626172"), "foobar"));
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+constexpr auto key = decodeLiteral<Base64, "AAECAwQ=">();
+static_assert(std::is_same_v<decltype(key), const std::array<std::uint8_t, 5>>);
+static_assert(key[0] == 0 && key[4] == 4);
+#endif
+
+} // namespace
+
+TEST(LiteralTest, MatchesRuntime)
+{
+	constexpr auto encoded = encodeLiteral<Base64>("Many hands make light work.");
+	std::string expected;
+	Base64{}.encode(std::string_view("Many hands make light work."), std::back_inserter(expected));
+	ASSERT_EQ(expected, std::string(encoded.begin(), encoded.end()));
+
+	constexpr std::array<std::uint8_t, 7> bytes = { 0, 0xFF, 0, 0x80, 1, 0, 0 };
+	constexpr auto encodedBytes = encodeLiteral<Base32>(bytes);
+	std::string expectedBytes;
+	Base32{}.encode(bytes, std::back_inserter(expectedBytes));
+	ASSERT_EQ(expectedBytes, std::string(encodedBytes.begin(), encodedBytes.end()));
+
+	constexpr auto decoded = decodeLiteral<Base32>("AD7QBAABAAAA====");
+	ASSERT_EQ(std::vector<std::uint8_t>(bytes.begin(), bytes.end())
+			, std::vector<std::uint8_t>(decoded.begin(), decoded.end()));
+}
+
+TEST(LiteralTest, InvalidAtRuntime)
+{
+	ASSERT_THROW(decodeLiteral<Base64>("Zm9v*mFy"), std::invalid_argument);
+	ASSERT_THROW(decodeLiteral<Base64>("Zm9vY"), std::invalid_argument);
+	ASSERT_THROW(decodeLiteral<Base64>("Zm9vYg="), std::invalid_argument);
+	ASSERT_THROW(decodeLiteral<Base64HexUnpadded>("Zm8="), std::invalid_argument);
+}
+
+}
+}
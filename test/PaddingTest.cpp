@@ -0,0 +1,149 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/BaseCoder.hpp>
+#include <BaseCoder/Stream.hpp>
+
+#include <list>
+
+namespace base_coder
+{
+namespace test
+{
+
+template<typename Trait>
+class PaddingTest : public ::testing::Test
+{
+protected:
+	using PaddedTrait = base_coder::Traits<Trait::type, Trait::subtype>;
+
+	void SetUp() override
+	{
+		randomData = makeRandomData(31, sizeRange(20));
+		randomData.emplace_back(5000, 0xA5);
+	}
+
+	///
+	/// \brief paddedEncode: encoding with pad
+	///
+	static std::string paddedEncode(const std::vector<std::uint8_t> &data)
+	{
+		std::string encoded;
+		BaseCoder<PaddedTrait>{}.encode(data, std::back_inserter(encoded));
+		return encoded;
+	}
+
+protected:
+	BaseCoder<Trait> coder;
+	std::vector<std::vector<std::uint8_t>> randomData;
+};
+
+using UnpaddedTraits = ::testing::Types<Base64HexUnpaddedTraits
+		, base_coder::Traits<Type::Base64, Subtype::Common, Padding::Forbidden>
+		, base_coder::Traits<Type::Base32, Subtype::Common, Padding::Forbidden>
+		, base_coder::Traits<Type::Base32, Subtype::Hex, Padding::Forbidden>
+		, base_coder::Traits<Type::Base16, Subtype::Common, Padding::Forbidden>>;
+TYPED_TEST_SUITE(PaddingTest, UnpaddedTraits);
+
+TYPED_TEST(PaddingTest, EncodeWithoutPad)
+{
+	for (const auto &data : this->randomData)
+	{
+		std::string expected = this->paddedEncode(data);
+		expected.erase(expected.find_last_not_of(TypeParam::pad) + 1);
+		ASSERT_EQ(expected.size(), this->coder.encodeSize(data));
+
+		std::string pointer(expected.size(), '\0');
+		ASSERT_EQ(expected.size(), this->coder.encode(data.data(), data.size()
+				, pointer.data()));
+		ASSERT_EQ(expected, pointer);
+
+		std::string iterator;
+		const std::list<std::uint8_t> list(data.begin(), data.end());
+		this->coder.encode(list, std::back_inserter(iterator));
+		ASSERT_EQ(expected, iterator);
+
+		std::string stream;
+		StreamEncoder<TypeParam> encoder;
+		encoder.update(data, std::back_inserter(stream));
+		encoder.finish(std::back_inserter(stream));
+		ASSERT_EQ(expected, stream);
+	}
+}
+
+TYPED_TEST(PaddingTest, Decode)
+{
+	for (const auto &data : this->randomData)
+	{
+		std::string encoded;
+		this->coder.encode(data, std::back_inserter(encoded));
+		ASSERT_EQ(data.size(), this->coder.decodeSize(encoded));
+
+		std::vector<std::uint8_t> pointer(data.size());
+		ASSERT_EQ(data.size(), this->coder.decode(encoded.data(), encoded.size()
+				, pointer.data()));
+		ASSERT_EQ(data, pointer);
+
+		std::vector<std::uint8_t> iterator;
+		const std::list<char> list(encoded.begin(), encoded.end());
+		this->coder.decode(list, std::back_inserter(iterator));
+		ASSERT_EQ(data, iterator);
+
+		std::vector<std::uint8_t> checked(data.size());
+		const DecodeResult result = this->coder.decodeChecked(encoded.data()
+				, encoded.size(), checked.data());
+		ASSERT_TRUE(result);
+		ASSERT_EQ(data.size(), result.written);
+		ASSERT_EQ(data, checked);
+
+		// pad isn't allowed
+		const std::string padded = this->paddedEncode(data);
+		if (padded != encoded)
+		{
+			const DecodeResult paddedResult = this->coder.validate(padded.data()
+					, padded.size());
+			ASSERT_EQ(DecodeStatus::InvalidPadding, paddedResult.status);
+			ASSERT_EQ(encoded.size(), paddedResult.errorOffset);
+		}
+	}
+}
+
+TEST(PaddingTest, Jwt)
+{
+	const Base64HexUnpadded coder;
+	const std::vector<std::uint8_t> data = { 0xFB, 0xFF };
+	std::string encoded;
+	coder.encode(data, std::back_inserter(encoded));
+	ASSERT_EQ("-_8", encoded);
+
+	for (const auto &[decoded, expected] : std::vector<std::pair<std::string, std::string>>{
+			{ "f", "Zg" }, { "fo", "Zm8" }, { "foo", "Zm9v" }, { "foob", "Zm9vYg" }
+			, { "fooba", "Zm9vYmE" }, { "foobar", "Zm9vYmFy" } })
+	{
+		std::string out;
+		coder.encode(decoded, std::back_inserter(out));
+		ASSERT_EQ(expected, out);
+	}
+}
+
+TEST(PaddingTest, Required)
+{
+	const BaseCoder<Traits<Type::Base64, Subtype::Common, Padding::Required>> coder;
+	ASSERT_TRUE(coder.validate("Zm9vYg==", 8));
+	ASSERT_TRUE(coder.validate("Zm9v", 4));
+
+	const DecodeResult result = coder.validate("Zm9vYg", 6);
+	ASSERT_EQ(DecodeStatus::InvalidPadding, result.status);
+	ASSERT_EQ(6, result.errorOffset);
+	ASSERT_EQ(3, result.written);
+}
+
+TEST(PaddingTest, Optional)
+{
+	const Base64 coder;
+	ASSERT_EQ(Padding::Optional, Base64::padding);
+	ASSERT_TRUE(coder.validate("Zm9vYg==", 8));
+	ASSERT_TRUE(coder.validate("Zm9vYg", 6));
+}
+
+}
+}
@@ -0,0 +1,92 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/Parallel.hpp>
+
+#include <thread>
+
+namespace base_coder
+{
+namespace test
+{
+
+template<typename Trait>
+class ParallelCoderTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		data = makeRandomData(11, { 100003 }).front();
+	}
+
+protected:
+	BaseCoder<Trait> coder;
+	std::vector<std::uint8_t> data;
+};
+
+using Traits = ::testing::Types<Base64Traits, Base32Traits, Base16Traits>;
+TYPED_TEST_SUITE(ParallelCoderTest, Traits);
+
+TYPED_TEST(ParallelCoderTest, MatchesSingleThread)
+{
+	for (size_t size : { size_t{ 0 }, size_t{ 1 }, size_t{ 1000 }, this->data.size() })
+	{
+		for (size_t threadCount : { 1, 2, 3, 8 })
+		{
+			ParallelOptions options;
+			options.threadCount = threadCount;
+			options.minimalSize = 0;
+			options.minimalPartSize = 1;
+
+			std::string expected(this->coder.encodeSize(
+					View(this->data.data(), this->data.data() + size)), '\0');
+			this->coder.encode(this->data.data(), size, expected.data());
+
+			std::string encoded(expected.size(), '\0');
+			ASSERT_EQ(encoded.size(), parallelEncode<TypeParam>(this->data.data(), size
+					, encoded.data(), options));
+			ASSERT_EQ(expected, encoded);
+
+			std::vector<std::uint8_t> decoded(size);
+			ASSERT_EQ(size, parallelDecode<TypeParam>(encoded.data(), encoded.size()
+					, decoded.data(), options));
+			ASSERT_TRUE(std::equal(decoded.begin(), decoded.end(), this->data.begin()));
+		}
+	}
+}
+
+TYPED_TEST(ParallelCoderTest, ConcurrentCalls)
+{
+	// callers share the pool, each of them waits for its own parts only
+	ParallelOptions options;
+	options.threadCount = 3;
+	options.minimalSize = 0;
+	options.minimalPartSize = 1;
+
+	std::string expected(this->coder.encodeSize(this->data), '\0');
+	this->coder.encode(this->data.data(), this->data.size(), expected.data());
+
+	std::vector<std::string> results(4, std::string(expected.size(), '\0'));
+	std::vector<std::thread> callers;
+	for (auto &result : results)
+	{
+		callers.emplace_back([this, &result, &options]()
+		{
+			for (int i = 0; i != 20; ++i)
+			{
+				parallelEncode<TypeParam>(this->data.data(), this->data.size(), result.data()
+						, options);
+			}
+		});
+	}
+	for (auto &caller : callers)
+	{
+		caller.join();
+	}
+	for (const auto &result : results)
+	{
+		ASSERT_EQ(expected, result);
+	}
+}
+
+}
+}
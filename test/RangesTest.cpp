@@ -0,0 +1,152 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/Ranges.hpp>
+
+#include <list>
+#include <sstream>
+
+namespace base_coder
+{
+namespace test
+{
+
+namespace
+{
+
+using EncodeString = decltype(std::declval<std::string &>() | views::encode<Base64>);
+using EncodeList = decltype(std::declval<std::list<std::uint8_t> &>() | views::encode<Base32>);
+using DecodeString = decltype(std::declval<std::string &>() | views::decode<Base64>);
+using DecodeFiltered = decltype(std::declval<std::string &>()
+		| std::views::filter([](char) { return true; }) | views::decode<Base16>);
+
+static_assert(std::ranges::view<EncodeString> && std::ranges::input_range<EncodeString>);
+static_assert(std::ranges::sized_range<EncodeString> && std::ranges::sized_range<EncodeList>);
+static_assert(std::is_same_v<std::ranges::range_value_t<EncodeString>, char>);
+static_assert(std::ranges::sized_range<DecodeString>);
+static_assert(std::ranges::input_range<DecodeFiltered> && !std::ranges::sized_range<DecodeFiltered>);
+static_assert(std::is_same_v<std::ranges::range_value_t<DecodeString>, std::uint8_t>);
+
+// elements wider than byte are rejected, as by BaseCoder
+template<typename Range, typename Adaptor>
+constexpr bool isPipeable = requires(Range &range) { range | Adaptor{}; };
+
+static_assert(isPipeable<std::vector<std::uint8_t>, detail::EncodeAdaptor<Base64Traits>>);
+static_assert(!isPipeable<std::vector<int>, detail::EncodeAdaptor<Base64Traits>>);
+static_assert(!isPipeable<std::list<int>, detail::EncodeAdaptor<Base64Traits>>);
+static_assert(isPipeable<std::string, detail::DecodeAdaptor<Base64Traits>>);
+static_assert(!isPipeable<std::vector<int>, detail::DecodeAdaptor<Base64Traits>>);
+static_assert(!std::invocable<decltype(views::encode<Base64>), std::vector<int> &>);
+static_assert(!std::invocable<decltype(views::decode<Base64>), std::vector<int> &>);
+
+} // namespace
+
+template<typename Coder>
+class RangesTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		randomData = makeRandomData(25, { 0, 1, 2, 3, 4, 5, 6, 7, 100, 191, 192, 193, 1000, 5000 });
+	}
+
+	static std::string encode(const std::vector<std::uint8_t> &data)
+	{
+		std::string encoded;
+		Coder{}.encode(data, std::back_inserter(encoded));
+		return encoded;
+	}
+
+protected:
+	std::vector<std::vector<std::uint8_t>> randomData;
+};
+
+using RangeCoders = ::testing::Types<Base64, Base64Hex, Base32, Base16, Base16Lower
+		, BaseCoder<Base64HexUnpaddedTraits>, Base32Crockford>;
+TYPED_TEST_SUITE(RangesTest, RangeCoders);
+
+TYPED_TEST(RangesTest, Encode)
+{
+	for (const auto &data : this->randomData)
+	{
+		const std::string expected = this->encode(data);
+
+		auto view = data | views::encode<TypeParam>;
+		ASSERT_EQ(expected.size(), view.size());
+		std::string encoded;
+		std::ranges::copy(view, std::back_inserter(encoded));
+		ASSERT_EQ(expected, encoded);
+
+		// not contiguous and not sized input
+		const std::list<std::uint8_t> list(data.begin(), data.end());
+		std::string fromList;
+		std::ranges::copy(list | std::views::filter([](std::uint8_t) { return true; })
+				| views::encode<TypeParam>, std::back_inserter(fromList));
+		ASSERT_EQ(expected, fromList);
+	}
+}
+
+TYPED_TEST(RangesTest, Decode)
+{
+	for (const auto &data : this->randomData)
+	{
+		const std::string encoded = this->encode(data);
+
+		auto view = views::decode<TypeParam>(encoded);
+		ASSERT_EQ(data.size(), view.size());
+		std::vector<std::uint8_t> decoded;
+		std::ranges::copy(view, std::back_inserter(decoded));
+		ASSERT_EQ(data, decoded);
+
+		const std::list<char> list(encoded.begin(), encoded.end());
+		std::vector<std::uint8_t> fromList;
+		std::ranges::copy(list | views::decode<TypeParam>, std::back_inserter(fromList));
+		ASSERT_EQ(data, fromList);
+	}
+}
+
+TYPED_TEST(RangesTest, Pipeline)
+{
+	for (const auto &data : this->randomData)
+	{
+		// nothing is materialized between encoding and decoding
+		std::vector<std::uint8_t> decoded;
+		std::ranges::copy(data | views::encode<TypeParam> | views::decode<TypeParam>
+				, std::back_inserter(decoded));
+		ASSERT_EQ(data, decoded);
+	}
+}
+
+TEST(RangesTest, InputRange)
+{
+	std::istringstream stream("Zm9vYmFy");
+	std::string decoded;
+	std::ranges::copy(std::views::istream<char>(stream) | views::decode<Base64>
+			, std::back_inserter(decoded));
+	ASSERT_EQ("foobar", decoded);
+}
+
+TEST(RangesTest, Hash)
+{
+	// FNV-1a of encoded characters
+	auto hash = [](auto &&range)
+	{
+		std::uint64_t result = 0xCBF29CE484222325ull;
+		for (char i : range)
+		{
+			result = (result ^ static_cast<std::uint8_t>(i)) * 0x100000001B3ull;
+		}
+		return result;
+	};
+	const std::string data(1000, 'x');
+	std::string encoded;
+	Base32{}.encode(data, std::back_inserter(encoded));
+	ASSERT_EQ(hash(encoded), hash(data | views::encode<Base32>));
+
+	std::string prefix;
+	std::ranges::copy(std::string_view(data) | std::views::take(1) | views::encode<Base32>
+			| std::views::take(2), std::back_inserter(prefix));
+	ASSERT_EQ("PA", prefix);
+}
+
+}
+}
@@ -0,0 +1,127 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/BaseCoder.hpp>
+
+namespace base_coder
+{
+namespace test
+{
+
+template<typename Coder>
+class SimdCoderTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		std::vector<std::size_t> sizes = sizeRange(300);
+		sizes.push_back(1 << 16);
+		randomData = makeRandomData<std::string>(42, sizes);
+	}
+
+	template<typename Callable>
+	std::string runScalar(Callable &&callable)
+	{
+		const SimdLevelGuard guard;
+		setSimdLevel(SimdLevel::Scalar);
+		std::string out;
+		callable(out);
+		return out;
+	}
+
+protected:
+	Coder coder;
+	std::vector<std::string> randomData;
+};
+
+using SimdCoders = ::testing::Types<Base64, Base64Hex, Base32, Base32Hex, Base16
+		, Base16Lower, Base32Crockford, ZBase32, Base64Bcrypt, Base64Imap>;
+TYPED_TEST_SUITE(SimdCoderTest, SimdCoders);
+
+TYPED_TEST(SimdCoderTest, EncodeMatchesScalar)
+{
+	for (const auto &data : this->randomData)
+	{
+		auto encode = [this, &data](std::string &out)
+		{
+			this->coder.encode(data, std::back_inserter(out));
+		};
+		const std::string expected = this->runScalar(encode);
+		forEachLevel([&]()
+		{
+			std::string out;
+			encode(out);
+			ASSERT_EQ(expected, out);
+		});
+	}
+}
+
+TYPED_TEST(SimdCoderTest, DecodeMatchesScalar)
+{
+	for (const auto &data : this->randomData)
+	{
+		std::string encoded;
+		this->coder.encode(data, std::back_inserter(encoded));
+
+		auto decode = [this, &encoded](std::string &out)
+		{
+			this->coder.decode(encoded, std::back_inserter(out));
+		};
+		const std::string expected = this->runScalar(decode);
+		forEachLevel([&]()
+		{
+			std::string out;
+			decode(out);
+			ASSERT_EQ(expected, out);
+		});
+	}
+}
+
+TYPED_TEST(SimdCoderTest, DecodeInvalidMatchesScalar)
+{
+	std::string encoded;
+	this->coder.encode(this->randomData.back(), std::back_inserter(encoded));
+	encoded[1000] = '*';
+	encoded[encoded.size() / 2] = '\x80';
+
+	auto decode = [this, &encoded](std::string &out)
+	{
+		this->coder.decode(encoded, std::back_inserter(out));
+	};
+	const std::string expected = this->runScalar(decode);
+	forEachLevel([&]()
+	{
+		std::string out;
+		decode(out);
+		ASSERT_EQ(expected, out);
+	});
+}
+
+TYPED_TEST(SimdCoderTest, Avx512VbmiRoundTrip)
+{
+	const SimdLevelGuard guard;
+	if (!setSimdLevel(SimdLevel::Avx512Vbmi))
+	{
+		GTEST_SKIP() << "CPU doesn't support AVX-512 VBMI";
+	}
+
+	for (const auto &data : this->randomData)
+	{
+		std::string encoded;
+		this->coder.encode(data, std::back_inserter(encoded));
+		std::string decoded;
+		this->coder.decode(encoded, std::back_inserter(decoded));
+
+		setSimdLevel(SimdLevel::Scalar);
+		std::string expectedEncoded;
+		this->coder.encode(data, std::back_inserter(expectedEncoded));
+		std::string expectedDecoded;
+		this->coder.decode(expectedEncoded, std::back_inserter(expectedDecoded));
+		setSimdLevel(SimdLevel::Avx512Vbmi);
+
+		ASSERT_EQ(expectedEncoded, encoded);
+		ASSERT_EQ(expectedDecoded, decoded);
+	}
+}
+
+}
+}
@@ -0,0 +1,142 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/Stream.hpp>
+
+#include <list>
+#include <random>
+
+namespace base_coder
+{
+namespace test
+{
+
+template<typename Trait>
+class StreamCoderTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		data.resize(10000);
+		for (auto &i : data)
+		{
+			i = static_cast<std::uint8_t>(generator());
+		}
+		coder.encode(data, std::back_inserter(encoded));
+	}
+
+	///
+	/// \brief Splitting size into random chunk sizes
+	///
+	std::vector<size_t> makeChunks(size_t size, size_t maxChunkSize)
+	{
+		std::vector<size_t> chunks;
+		while (size)
+		{
+			const size_t chunk = std::min<size_t>(size, 1 + generator() % maxChunkSize);
+			chunks.push_back(chunk);
+			size -= chunk;
+		}
+		return chunks;
+	}
+
+protected:
+	BaseCoder<Trait> coder;
+	std::mt19937 generator{ 3 };
+	std::vector<std::uint8_t> data;
+	std::string encoded;
+};
+
+using Traits = ::testing::Types<Base64Traits, Base64HexTraits, Base32Traits
+		, Base32HexTraits, Base16Traits>;
+TYPED_TEST_SUITE(StreamCoderTest, Traits);
+
+TYPED_TEST(StreamCoderTest, Encode)
+{
+	for (size_t maxChunkSize : { 1, 7, 100, 5000 })
+	{
+		StreamEncoder<TypeParam> encoder;
+		std::string out;
+		size_t position = 0;
+		for (size_t chunk : this->makeChunks(this->data.size(), maxChunkSize))
+		{
+			encoder.update(View(this->data.begin() + position
+					, this->data.begin() + position + chunk), std::back_inserter(out));
+			position += chunk;
+		}
+		encoder.finish(std::back_inserter(out));
+		ASSERT_EQ(this->encoded, out);
+	}
+}
+
+TYPED_TEST(StreamCoderTest, EncodeNotContiguous)
+{
+	const std::list<std::uint8_t> list(this->data.begin(), this->data.end());
+	StreamEncoder<TypeParam> encoder;
+	std::string out;
+	auto it = list.begin();
+	for (size_t chunk : this->makeChunks(list.size(), 1000))
+	{
+		auto end = std::next(it, chunk);
+		encoder.update(View(it, end), std::back_inserter(out));
+		it = end;
+	}
+	encoder.finish(std::back_inserter(out));
+	ASSERT_EQ(this->encoded, out);
+}
+
+TYPED_TEST(StreamCoderTest, EncodeToPointer)
+{
+	StreamEncoder<TypeParam> encoder;
+	std::string out(this->encoded.size(), '\0');
+	char *outputIterator = out.data();
+	size_t position = 0;
+	for (size_t chunk : this->makeChunks(this->data.size(), 300))
+	{
+		outputIterator = encoder.update(View(this->data.data() + position
+				, this->data.data() + position + chunk), outputIterator);
+		position += chunk;
+	}
+	outputIterator = encoder.finish(outputIterator);
+	ASSERT_EQ(out.data() + out.size(), outputIterator);
+	ASSERT_EQ(this->encoded, out);
+}
+
+TYPED_TEST(StreamCoderTest, Decode)
+{
+	for (size_t maxChunkSize : { 1, 7, 100, 5000 })
+	{
+		StreamDecoder<TypeParam> decoder;
+		std::vector<std::uint8_t> out;
+		size_t position = 0;
+		for (size_t chunk : this->makeChunks(this->encoded.size(), maxChunkSize))
+		{
+			decoder.update(View(this->encoded.begin() + position
+					, this->encoded.begin() + position + chunk), std::back_inserter(out));
+			position += chunk;
+		}
+		decoder.finish(std::back_inserter(out));
+		ASSERT_EQ(this->data, out);
+	}
+}
+
+TYPED_TEST(StreamCoderTest, DecodeTail)
+{
+	for (size_t size = 0; size != 20; ++size)
+	{
+		const std::vector<std::uint8_t> data(this->data.begin(), this->data.begin() + size);
+		std::string encoded;
+		this->coder.encode(data, std::back_inserter(encoded));
+
+		StreamDecoder<TypeParam> decoder;
+		std::vector<std::uint8_t> out;
+		for (char i : encoded)
+		{
+			decoder.update(std::string(1, i), std::back_inserter(out));
+		}
+		decoder.finish(std::back_inserter(out));
+		ASSERT_EQ(data, out);
+	}
+}
+
+}
+}
@@ -0,0 +1,96 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/BaseCoder.hpp>
+#include <BaseCoder/Swar.hpp>
+
+namespace base_coder
+{
+namespace test
+{
+
+template<typename Trait>
+class SwarTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		std::vector<std::size_t> sizes = sizeRange(40);
+		for (auto &size : sizes)
+		{
+			size *= Trait::inputBufferSize;
+		}
+		randomData = makeRandomData(17, sizes);
+	}
+
+	///
+	/// \brief referenceEncode: bit by bit encoding of whole blocks
+	///
+	static std::string referenceEncode(const std::vector<std::uint8_t> &data)
+	{
+		std::string out;
+		for (size_t bit = 0; bit != data.size() * CHAR_BIT; bit += Trait::indexBitSize)
+		{
+			size_t index = 0;
+			for (size_t i = bit; i != bit + Trait::indexBitSize; ++i)
+			{
+				index = (index << 1) | ((data[i / CHAR_BIT] >> (7 - i % CHAR_BIT)) & 1);
+			}
+			out.push_back(Trait::alphabet[index]);
+		}
+		return out;
+	}
+
+protected:
+	std::vector<std::vector<std::uint8_t>> randomData;
+};
+
+using AllTraits = ::testing::Types<Base64Traits, Base64HexTraits, Base32Traits
+		, Base32HexTraits, Base16Traits>;
+TYPED_TEST_SUITE(SwarTest, AllTraits);
+
+TYPED_TEST(SwarTest, EncodeMatchesReference)
+{
+	for (const auto &data : this->randomData)
+	{
+		const std::string expected = this->referenceEncode(data);
+		std::string out(expected.size(), '\0');
+		ASSERT_EQ(data.size(), swar::encode<TypeParam>(data.data(), data.size()
+				, out.data()));
+		ASSERT_EQ(expected, out);
+	}
+}
+
+TYPED_TEST(SwarTest, DecodeRoundTrip)
+{
+	for (const auto &data : this->randomData)
+	{
+		const std::string encoded = this->referenceEncode(data);
+		std::vector<std::uint8_t> out(data.size());
+		ASSERT_EQ(encoded.size(), swar::decode<TypeParam>(encoded.data(), encoded.size()
+				, out.data()));
+		ASSERT_EQ(data, out);
+	}
+}
+
+TYPED_TEST(SwarTest, DecodeStopsBeforeInvalidWord)
+{
+	const auto &data = this->randomData.back();
+	const std::string valid = this->referenceEncode(data);
+	for (size_t offset = 0; offset < valid.size(); offset += 7)
+	{
+		std::string encoded = valid;
+		encoded[offset] = (offset % 2) ? '*' : TypeParam::pad;
+		std::vector<std::uint8_t> out(data.size());
+		const size_t position = swar::decode<TypeParam>(encoded.data(), encoded.size()
+				, out.data());
+		ASSERT_LE(position, offset);
+		ASSERT_EQ(0, position % TypeParam::indexBufferSize);
+		ASSERT_GT(position + 8, offset);
+		const size_t written = position / TypeParam::indexBufferSize
+				* TypeParam::inputBufferSize;
+		ASSERT_TRUE(std::equal(out.begin(), out.begin() + written, data.begin()));
+	}
+}
+
+}
+}
@@ -0,0 +1,136 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/Transcode.hpp>
+
+namespace base_coder
+{
+namespace test
+{
+
+template<typename FROM, typename TO>
+struct TraitPair
+{
+	using From = FROM;
+	using To = TO;
+};
+
+template<typename Pair>
+class TranscodeTest : public ::testing::Test
+{
+protected:
+	using From = typename Pair::From;
+	using To = typename Pair::To;
+
+	void SetUp() override
+	{
+		randomData = makeRandomData(37, { 0, 1, 2, 3, 4, 5, 6, 14, 15, 16, 100, 16383, 16384
+				, 16385, 100000 });
+	}
+
+	template<typename Trait>
+	static std::string encode(const std::vector<std::uint8_t> &data)
+	{
+		std::string encoded;
+		BaseCoder<Trait>{}.encode(data, std::back_inserter(encoded));
+		return encoded;
+	}
+
+	static DecodeResult transcode(const std::string &input, std::string &output)
+	{
+		output.assign(upperBoundTranscodeSize<From, To>(input.size()), '\0');
+		const DecodeResult result = base_coder::transcode<From, To>(input.data()
+				, input.size(), output.data());
+		output.resize(result.written);
+		return result;
+	}
+
+protected:
+	std::vector<std::vector<std::uint8_t>> randomData;
+};
+
+using Pairs = ::testing::Types<TraitPair<Base64Traits, Base32Traits>
+		, TraitPair<Base64Traits, Base16LowerTraits>
+		, TraitPair<Base32HexTraits, Base64HexUnpaddedTraits>
+		, TraitPair<Base16Traits, Base64Traits>
+		, TraitPair<Base64Traits, Base64HexTraits>
+		, TraitPair<Base64Traits, Base64HexUnpaddedTraits>
+		, TraitPair<Base64HexUnpaddedTraits, Base64Traits>
+		, TraitPair<Base32Traits, Base32HexTraits>
+		, TraitPair<Base16Traits, Base16LowerTraits>>;
+TYPED_TEST_SUITE(TranscodeTest, Pairs);
+
+TYPED_TEST(TranscodeTest, MatchesDecodeEncode)
+{
+	using From = typename TestFixture::From;
+	using To = typename TestFixture::To;
+
+	forEachLevel([&]()
+	{
+		for (const auto &data : this->randomData)
+		{
+			const std::string input = this->template encode<From>(data);
+			const std::string expected = this->template encode<To>(data);
+			ASSERT_EQ(expected.size(), (transcodeSize<From, To>(input.data(), input.size())));
+			ASSERT_GE((upperBoundTranscodeSize<From, To>(input.size())), expected.size());
+
+			std::string output;
+			const DecodeResult result = this->transcode(input, output);
+			ASSERT_TRUE(result);
+			ASSERT_EQ(input.size(), result.errorOffset);
+			ASSERT_EQ(expected, output);
+		}
+	});
+}
+
+TYPED_TEST(TranscodeTest, InvalidInput)
+{
+	using From = typename TestFixture::From;
+	using To = typename TestFixture::To;
+
+	const auto &data = this->randomData.back();
+	const std::string valid = this->template encode<From>(data);
+	const std::string expected = this->template encode<To>(data);
+	for (size_t offset : { size_t{ 0 }, size_t{ 9 }, size_t{ 30000 }, valid.size() - 5 })
+	{
+		std::string input = valid;
+		input[offset] = '*';
+		std::string output;
+		const DecodeResult result = this->transcode(input, output);
+		ASSERT_EQ(DecodeStatus::InvalidCharacter, result.status);
+		ASSERT_EQ(offset, result.errorOffset);
+		// whole blocks of bytes before the bad character
+		ASSERT_EQ(0, output.size() % To::indexBufferSize);
+		ASSERT_LE(output.size() / To::indexBufferSize * To::inputBufferSize
+				, offset / From::indexBufferSize * From::inputBufferSize);
+		ASSERT_EQ(expected.substr(0, output.size()), output);
+	}
+
+	if (From::type == Type::Base16)
+	{
+		return;
+	}
+
+	// pad followed by data
+	const std::string padded = this->template encode<Traits<From::type, From::subtype>>(
+			{ 1, 2, 3, 4 });
+	const size_t padOffset = padded.find(From::pad);
+	ASSERT_NE(std::string::npos, padOffset);
+	std::string output;
+	const DecodeResult result = this->transcode(padded + valid, output);
+	ASSERT_FALSE(result);
+	ASSERT_EQ(padOffset, result.errorOffset);
+}
+
+TEST(TranscodeTest, Span)
+{
+	const std::string input = "Zm9vYmE=";
+	std::string output(upperBoundTranscodeSize<Base64Traits, Base32Traits>(input.size()), '\0');
+	const DecodeResult result = transcode<Base64Traits, Base32Traits>(
+			std::span<const char>(input), std::span<char>(output));
+	ASSERT_TRUE(result);
+	output.resize(result.written);
+	ASSERT_EQ("MZXW6YTB", output);
+}
+
+}
+}
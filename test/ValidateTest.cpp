@@ -0,0 +1,154 @@
+#include "BaseCoderTest.hpp"
+
+#include <BaseCoder/BaseCoder.hpp>
+
+namespace base_coder
+{
+namespace test
+{
+
+template<typename Coder>
+class ValidateCoderTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		randomData = makeRandomData(11, { 0, 1, 2, 3, 4, 5, 6, 7, 31, 100, 1000, 5000 });
+		for (const auto &data : randomData)
+		{
+			std::string encoded;
+			coder.encode(data, std::back_inserter(encoded));
+			encodedData.push_back(std::move(encoded));
+		}
+	}
+
+	DecodeResult decodeChecked(const std::string &encoded, std::vector<std::uint8_t> &out)
+	{
+		out.assign(coder.upperBoundDecodeSize(encoded.size()), 0);
+		const DecodeResult result = coder.decodeChecked(encoded.data(), encoded.size()
+				, out.data());
+		out.resize(result.written);
+		return result;
+	}
+
+protected:
+	Coder coder;
+	std::vector<std::vector<std::uint8_t>> randomData;
+	std::vector<std::string> encodedData;
+};
+
+using Coders = ::testing::Types<Base64, Base64Hex, Base32, Base32Hex, Base16, Base16Lower>;
+TYPED_TEST_SUITE(ValidateCoderTest, Coders);
+
+TYPED_TEST(ValidateCoderTest, ValidData)
+{
+	forEachLevel([this]()
+	{
+		for (size_t i = 0; i != this->randomData.size(); ++i)
+		{
+			const std::string &encoded = this->encodedData[i];
+			std::vector<std::uint8_t> out;
+			const DecodeResult result = this->decodeChecked(encoded, out);
+			ASSERT_TRUE(result);
+			ASSERT_EQ(encoded.size(), result.errorOffset);
+			ASSERT_EQ(this->randomData[i], out);
+
+			const DecodeResult validated = this->coder.validate(encoded.data()
+					, encoded.size());
+			ASSERT_TRUE(validated);
+			ASSERT_EQ(out.size(), validated.written);
+		}
+	});
+}
+
+TYPED_TEST(ValidateCoderTest, InvalidCharacter)
+{
+	const std::string &valid = this->encodedData.back();
+	forEachLevel([&]()
+	{
+		for (size_t offset : { size_t{ 0 }, size_t{ 1 }, size_t{ 17 }, size_t{ 100 }
+				, size_t{ 4093 }, valid.size() / 2, valid.size() - 20 })
+		{
+			for (char bad : { '*', '\x80', '\0', ' ' })
+			{
+				std::string encoded = valid;
+				encoded[offset] = bad;
+				encoded[offset + 3] = '*';
+
+				std::vector<std::uint8_t> out;
+				const DecodeResult result = this->decodeChecked(encoded, out);
+				ASSERT_EQ(DecodeStatus::InvalidCharacter, result.status);
+				ASSERT_EQ(offset, result.errorOffset);
+				const size_t blockOffset = offset / TypeParam::indexBufferSize;
+				ASSERT_EQ(blockOffset * TypeParam::inputBufferSize, result.written);
+				ASSERT_TRUE(std::equal(out.begin(), out.end()
+						, this->randomData.back().begin()));
+
+				const DecodeResult validated = this->coder.validate(encoded.data()
+						, encoded.size());
+				ASSERT_EQ(DecodeStatus::InvalidCharacter, validated.status);
+				ASSERT_EQ(offset, validated.errorOffset);
+			}
+		}
+	});
+}
+
+TYPED_TEST(ValidateCoderTest, InvalidPadding)
+{
+	std::string encoded = this->encodedData.back();
+	encoded[1000] = TypeParam::pad;
+	const DecodeResult result = this->coder.validate(encoded.data(), encoded.size());
+	ASSERT_EQ(DecodeStatus::InvalidPadding, result.status);
+	ASSERT_EQ(1000, result.errorOffset);
+
+	const std::string block(TypeParam::indexBufferSize, TypeParam::alphabet[1]);
+	const std::string tooManyPads = block + std::string(TypeParam::indexBufferSize
+			, TypeParam::pad);
+	ASSERT_EQ(DecodeStatus::InvalidPadding
+			, this->coder.validate(tooManyPads.data(), tooManyPads.size()).status);
+
+	// pad after the shortest valid tail must complete the block
+	const std::string shortTail = block + block.substr(0, 2) + TypeParam::pad;
+	const DecodeResult shortResult = this->coder.validate(shortTail.data()
+			, shortTail.size());
+	ASSERT_EQ(DecodeStatus::InvalidPadding, shortResult.status);
+	ASSERT_EQ(block.size() + 2, shortResult.errorOffset);
+}
+
+TYPED_TEST(ValidateCoderTest, InvalidLength)
+{
+	const std::string encoded = std::string(TypeParam::indexBufferSize + 1
+			, TypeParam::alphabet[2]);
+	const DecodeResult result = this->coder.validate(encoded.data(), encoded.size());
+	ASSERT_EQ(DecodeStatus::InvalidLength, result.status);
+	ASSERT_EQ(encoded.size(), result.errorOffset);
+	ASSERT_EQ(TypeParam::inputBufferSize, result.written);
+}
+
+TEST(ValidateTest, Base64Unpadded)
+{
+	const Base64 coder;
+	const std::string encoded = "Zm9vYg";
+	std::vector<std::uint8_t> out(coder.upperBoundDecodeSize(encoded.size()));
+	const DecodeResult result = coder.decodeChecked(encoded.data(), encoded.size()
+			, out.data());
+	ASSERT_TRUE(result);
+	ASSERT_EQ(4, result.written);
+	ASSERT_EQ("foob", std::string(out.begin(), out.begin() + result.written));
+}
+
+#if defined(__cpp_lib_span)
+TEST(ValidateTest, Span)
+{
+	const Base64 coder;
+	const std::string encoded = "Zm9vYmE=";
+	std::array<std::byte, 6> out{};
+	const DecodeResult result = coder.decodeChecked(std::span<const char>(encoded), out);
+	ASSERT_TRUE(result);
+	ASSERT_EQ(5, result.written);
+	ASSERT_TRUE(coder.validate(std::span<const char>(encoded)));
+}
+#endif
+
+}
+}
@@ -0,0 +1,673 @@
+#include <BaseCoder/BaseCoder.hpp>
+#include <BaseCoder/Parallel.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace
+{
+
+using namespace base_coder;
+
+constexpr const char usage[] =
+		"usage: basecoder [-d] [-t TYPE] [-j THREADS] [--stats] [INPUT [OUTPUT]]\n"
+		"\n"
+		"Encode INPUT (or standard input) to OUTPUT (or standard output).\n"
+		"\n"
+		"  -d, --decode        decode data\n"
+		"  -t, --type TYPE     base64 (default), base64url, base32, base32hex, base16\n"
+		"  -j, --threads N     count of threads, 0 for all cores (default 1)\n"
+		"      --stats         print throughput to standard error\n"
+		"  -h, --help          print this help\n"
+		"\n"
+		"Encoded output has no trailing line break, one trailing line break\n"
+		"(LF or CR LF) of encoded input is ignored, wrapped input is rejected.\n"
+		"Regular files are memory mapped, pipes are processed by chunks.\n";
+
+///
+/// \brief The Options struct: parsed command line
+///
+struct Options
+{
+	bool decode = false; ///<
+	bool stats = false; ///<
+	std::string_view type = "base64"; ///<
+	std::size_t threadCount = 1; ///<
+	std::string input; ///< empty or "-" for standard input
+	std::string output; ///< empty or "-" for standard output
+};
+
+///
+/// \brief The Stats struct: what was done, for --stats
+///
+struct Stats
+{
+	const char *mode = ""; ///< "mmap" or "stream"
+	std::size_t inputSize = 0; ///<
+	std::size_t outputSize = 0; ///<
+};
+
+///
+/// \brief The UsageError class: bad command line
+///
+class UsageError : public std::runtime_error
+{
+public:
+	using std::runtime_error::runtime_error;
+};
+
+///
+/// \brief systemError
+/// \param what
+/// \return exception for errno
+///
+std::system_error systemError(const std::string &what)
+{
+	return std::system_error(errno, std::generic_category(), what);
+}
+
+///
+/// \brief The File class: owner of file descriptor
+///
+class File
+{
+public:
+	File(int descriptor, bool owned) : descriptor{ descriptor }, owned{ owned }
+	{}
+
+	File(const std::string &path, int flags)
+			: descriptor{ ::open(path.c_str(), flags | O_CLOEXEC, 0666) }, owned{ true }
+	{
+		if (descriptor < 0)
+		{
+			throw systemError(path);
+		}
+	}
+
+	File(const File &) = delete;
+	File &operator=(const File &) = delete;
+
+	~File()
+	{
+		if (owned)
+		{
+			::close(descriptor);
+		}
+	}
+
+	int get() const
+	{
+		return descriptor;
+	}
+
+	///
+	/// \brief regularSize
+	/// \return size of regular file, -1 for pipes, sockets and terminals
+	///
+	off_t regularSize() const
+	{
+		struct stat status;
+		if (::fstat(descriptor, &status) != 0)
+		{
+			throw systemError("fstat");
+		}
+		return S_ISREG(status.st_mode) ? status.st_size : -1;
+	}
+
+	///
+	/// \brief isSame
+	/// \param path
+	/// \return true if path exists and refers to this file
+	///
+	bool isSame(const std::string &path) const
+	{
+		struct stat status;
+		struct stat other;
+		if (::fstat(descriptor, &status) != 0)
+		{
+			throw systemError("fstat");
+		}
+		if (::stat(path.c_str(), &other) != 0)
+		{
+			if (errno == ENOENT)
+			{
+				return false;
+			}
+			throw systemError(path);
+		}
+		return status.st_dev == other.st_dev && status.st_ino == other.st_ino;
+	}
+
+	///
+	/// \brief readFull: read until buffer is full or end of file
+	/// \return count of read bytes, less than size only at end of file
+	///
+	std::size_t readFull(void *buffer, std::size_t size) const
+	{
+		std::size_t position = 0;
+		while (position != size)
+		{
+			const ssize_t count = ::read(descriptor, static_cast<char *>(buffer) + position
+					, size - position);
+			if (count == 0)
+			{
+				break;
+			}
+			if (count < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				throw systemError("read");
+			}
+			position += static_cast<std::size_t>(count);
+		}
+		return position;
+	}
+
+	void writeAll(const void *buffer, std::size_t size) const
+	{
+		std::size_t position = 0;
+		while (position != size)
+		{
+			const ssize_t count = ::write(descriptor
+					, static_cast<const char *>(buffer) + position, size - position);
+			if (count < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				throw systemError("write");
+			}
+			position += static_cast<std::size_t>(count);
+		}
+	}
+
+	void truncate(std::size_t size) const
+	{
+		if (::ftruncate(descriptor, static_cast<off_t>(size)) != 0)
+		{
+			throw systemError("ftruncate");
+		}
+	}
+
+private:
+	int descriptor; ///<
+	bool owned; ///< descriptor is closed on destruction
+};
+
+///
+/// \brief The Mapping class: sequentially accessed memory mapping of whole file
+///
+class Mapping
+{
+public:
+	Mapping(const File &file, std::size_t size, bool writable) : size{ size }
+	{
+		if (size == 0)
+		{
+			return;
+		}
+		data = ::mmap(nullptr, size, writable ? PROT_READ | PROT_WRITE : PROT_READ
+				, writable ? MAP_SHARED : MAP_PRIVATE, file.get(), 0);
+		if (data == MAP_FAILED)
+		{
+			data = nullptr;
+			throw systemError("mmap");
+		}
+		// advice only, kernel is free to ignore it
+		::madvise(data, size, MADV_SEQUENTIAL);
+	}
+
+	Mapping(const Mapping &) = delete;
+	Mapping &operator=(const Mapping &) = delete;
+
+	~Mapping()
+	{
+		if (data)
+		{
+			::munmap(data, size);
+		}
+	}
+
+	template<typename Type>
+	Type *get() const
+	{
+		return static_cast<Type *>(data);
+	}
+
+private:
+	void *data = nullptr; ///<
+	std::size_t size; ///<
+};
+
+///
+/// \brief The Tool class: encoding and decoding of files by one coder
+/// \tparam Trait
+///
+template<typename Trait>
+class Tool
+{
+	using Coder = BaseCoder<Trait>;
+	using AlphabetType = typename Trait::AlphabetType;
+
+	static constexpr std::size_t chunkBlocks = std::size_t{ 1 } << 16;
+
+public:
+	explicit Tool(const Options &options)
+	{
+		parallel.threadCount = options.threadCount;
+	}
+
+	///
+	/// \brief mapped: process between mappings of input and output files
+	/// \param input regular file
+	/// \param inputSize
+	/// \param output
+	/// \param decode
+	/// \return
+	///
+	Stats mapped(const File &input, std::size_t inputSize, const File &output, bool decode) const
+	{
+		Stats stats{ "mmap", inputSize, 0 };
+		const Mapping inputMapping(input, inputSize, false);
+		if (decode)
+		{
+			// validated before the output is resized, so it is not filled with zeros
+			const AlphabetType *in = inputMapping.get<const AlphabetType>();
+			const std::size_t size = trimLineBreak(in, inputSize);
+			check(coder.validate(in, size), in, 0);
+			stats.outputSize = coder.decodeSize(View(in, in + size));
+			output.truncate(stats.outputSize);
+			const Mapping outputMapping(output, stats.outputSize, true);
+			parallelDecode<Trait>(in, size, outputMapping.get<std::uint8_t>(), parallel);
+		}
+		else
+		{
+			const std::uint8_t *in = inputMapping.get<const std::uint8_t>();
+			stats.outputSize = coder.encodeSize(View(in, in + inputSize));
+			output.truncate(stats.outputSize);
+			const Mapping outputMapping(output, stats.outputSize, true);
+			parallelEncode<Trait>(in, inputSize, outputMapping.get<AlphabetType>(), parallel);
+		}
+		return stats;
+	}
+
+	///
+	/// \brief streamEncode: read/write loop for pipes
+	/// \param input
+	/// \param output
+	/// \return
+	///
+	Stats streamEncode(const File &input, const File &output) const
+	{
+		// every chunk but the last is whole blocks, so no carry is needed
+		Stats stats{ "stream", 0, 0 };
+		std::vector<std::uint8_t> in(chunkBlocks * Trait::inputBufferSize);
+		std::vector<AlphabetType> out(chunkBlocks * Trait::indexBufferSize);
+		for (std::size_t size = in.size(); size == in.size(); )
+		{
+			size = input.readFull(in.data(), in.size());
+			const std::size_t written = parallelEncode<Trait>(in.data(), size, out.data()
+					, parallel);
+			output.writeAll(out.data(), written * sizeof(AlphabetType));
+			stats.inputSize += size;
+			stats.outputSize += written;
+		}
+		return stats;
+	}
+
+	///
+	/// \brief streamDecode: read/write loop for pipes
+	/// \param input
+	/// \param output
+	/// \return
+	///
+	Stats streamDecode(const File &input, const File &output) const
+	{
+		// the last block is held back until the end of input, only it may have pad,
+		// at least two characters are held back for trailing CR LF
+		Stats stats{ "stream", 0, 0 };
+		const std::size_t chunkSize = chunkBlocks * Trait::indexBufferSize;
+		std::vector<AlphabetType> in(chunkSize + Trait::indexBufferSize);
+		std::vector<std::uint8_t> out(Coder::upperBoundDecodeSize(in.size()));
+		std::size_t pending = 0;
+		for (bool last = false; !last; )
+		{
+			const std::size_t count = input.readFull(in.data() + pending
+					, chunkSize * sizeof(AlphabetType)) / sizeof(AlphabetType);
+			last = (count != chunkSize);
+			const std::size_t total = pending + count;
+			const std::size_t size = last ? trimLineBreak(in.data(), total) : total;
+			const std::size_t part = last
+					? size
+					: (size - 2) / Trait::indexBufferSize * Trait::indexBufferSize;
+
+			const std::size_t written = checkedDecode(in.data(), part, out.data()
+					, stats.inputSize);
+			if (!last && written != part / Trait::indexBufferSize * Trait::inputBufferSize)
+			{
+				throw std::runtime_error("unexpected pad at offset "
+						+ std::to_string(stats.inputSize + static_cast<std::size_t>(
+						std::find(in.data(), in.data() + part, Trait::pad) - in.data())));
+			}
+			output.writeAll(out.data(), written);
+
+			pending = size - part;
+			std::copy(in.begin() + part, in.begin() + size, in.begin());
+			stats.inputSize += last ? total : part;
+			stats.outputSize += written;
+		}
+		return stats;
+	}
+
+private:
+	///
+	/// \brief trimLineBreak
+	/// \param input
+	/// \param size
+	/// \return size of input without one trailing LF or CR LF
+	///
+	static std::size_t trimLineBreak(const AlphabetType *input, std::size_t size)
+	{
+		if (size != 0 && input[size - 1] == AlphabetType('\n'))
+		{
+			--size;
+			if (size != 0 && input[size - 1] == AlphabetType('\r'))
+			{
+				--size;
+			}
+		}
+		return size;
+	}
+
+	///
+	/// \brief checkedDecode
+	/// \param input
+	/// \param size
+	/// \param output buffer for decodeSize bytes
+	/// \param offset of input in whole encoded data, for error message
+	/// \return count of written bytes
+	/// \throw std::runtime_error for invalid input
+	///
+	std::size_t checkedDecode(const AlphabetType *input, std::size_t size
+			, std::uint8_t *output, std::size_t offset) const
+	{
+		// threads decode unchecked parts, so data is validated before
+		const bool threaded = parallel.threadCount != 1;
+		const DecodeResult result = threaded
+				? coder.validate(input, size)
+				: coder.decodeChecked(input, size, output);
+		check(result, input, offset);
+		return threaded
+				? parallelDecode<Trait>(input, size, output, parallel)
+				: result.written;
+	}
+
+	///
+	/// \brief check
+	/// \param result
+	/// \param input checked data
+	/// \param offset of input in whole encoded data, for error message
+	/// \throw std::runtime_error for invalid input
+	///
+	static void check(const DecodeResult &result, const AlphabetType *input
+			, std::size_t offset)
+	{
+		switch (result.status)
+		{
+		case DecodeStatus::Ok:
+			break;
+		case DecodeStatus::InvalidCharacter:
+			// wrapped output of base64(1) is the most likely invalid input
+			if (input[result.errorOffset] == AlphabetType('\n')
+					|| input[result.errorOffset] == AlphabetType('\r'))
+			{
+				throw std::runtime_error("line break at offset "
+						+ std::to_string(offset + result.errorOffset)
+						+ ", wrapped input is not supported, encode with 'base64 -w0'");
+			}
+			throw std::runtime_error("invalid character at offset "
+					+ std::to_string(offset + result.errorOffset));
+		case DecodeStatus::InvalidPadding:
+			throw std::runtime_error("invalid padding at offset "
+					+ std::to_string(offset + result.errorOffset));
+		case DecodeStatus::InvalidLength:
+			throw std::runtime_error("invalid length of encoded data");
+		}
+	}
+
+private:
+	Coder coder; ///<
+	ParallelOptions parallel; ///<
+};
+
+///
+/// \brief parseOptions
+/// \param argc
+/// \param argv
+/// \return
+/// \throw UsageError
+///
+Options parseOptions(int argc, char **argv)
+{
+	Options options;
+	std::vector<std::string> paths;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view argument = argv[i];
+		auto value = [&]() -> std::string_view
+		{
+			if (i + 1 == argc)
+			{
+				throw UsageError("missing value of " + std::string(argument));
+			}
+			return argv[++i];
+		};
+
+		if (argument == "-d" || argument == "--decode")
+		{
+			options.decode = true;
+		}
+		else if (argument == "-t" || argument == "--type")
+		{
+			options.type = value();
+		}
+		else if (argument == "-j" || argument == "--threads")
+		{
+			const std::string threads(value());
+			char *end = nullptr;
+			options.threadCount = std::strtoul(threads.c_str(), &end, 10);
+			if (threads.empty() || *end != '\0')
+			{
+				throw UsageError("bad count of threads: " + threads);
+			}
+			if (options.threadCount == 0)
+			{
+				options.threadCount = ParallelOptions{}.threadCount;
+			}
+		}
+		else if (argument == "--stats")
+		{
+			options.stats = true;
+		}
+		else if (argument == "-h" || argument == "--help")
+		{
+			std::fputs(usage, stdout);
+			std::exit(EXIT_SUCCESS);
+		}
+		else if (argument.size() > 1 && argument[0] == '-')
+		{
+			throw UsageError("unknown option " + std::string(argument));
+		}
+		else
+		{
+			paths.emplace_back(argument);
+		}
+	}
+	if (paths.size() > 2)
+	{
+		throw UsageError("too many files");
+	}
+	paths.resize(2);
+	options.input = paths[0];
+	options.output = paths[1];
+	return options;
+}
+
+bool isStandard(const std::string &path)
+{
+	return path.empty() || path == "-";
+}
+
+///
+/// \brief removeOnError: partial output in regular file is not left behind
+/// \param output
+/// \param path of output
+/// \param process
+/// \return result of process
+///
+template<typename Process>
+Stats removeOnError(const File &output, const std::string &path, Process &&process)
+{
+	if (isStandard(path) || output.regularSize() < 0)
+	{
+		return process();
+	}
+	try
+	{
+		return process();
+	}
+	catch (...)
+	{
+		::unlink(path.c_str());
+		throw;
+	}
+}
+
+///
+/// \brief run: choose mapped or streaming processing
+/// \tparam Trait
+/// \param options
+/// \return
+///
+template<typename Trait>
+Stats run(const Options &options)
+{
+	const Tool<Trait> tool(options);
+	const File input = isStandard(options.input)
+			? File(STDIN_FILENO, false)
+			: File(options.input, O_RDONLY);
+	const off_t inputSize = input.regularSize();
+
+	// output is truncated on open, in-place processing would destroy input
+	if (!isStandard(options.output) && input.isSame(options.output))
+	{
+		throw std::runtime_error("input and output are the same file: " + options.output);
+	}
+
+	// mapped output needs read access, so standard output is always written
+	if (inputSize >= 0 && !isStandard(options.output))
+	{
+		const File output(options.output, O_RDWR | O_CREAT | O_TRUNC);
+		if (output.regularSize() >= 0)
+		{
+			return removeOnError(output, options.output, [&]()
+			{
+				return tool.mapped(input, static_cast<std::size_t>(inputSize), output
+						, options.decode);
+			});
+		}
+	}
+
+	const File output = isStandard(options.output)
+			? File(STDOUT_FILENO, false)
+			: File(options.output, O_WRONLY | O_CREAT | O_TRUNC);
+	return removeOnError(output, options.output, [&]()
+	{
+		return options.decode
+				? tool.streamDecode(input, output)
+				: tool.streamEncode(input, output);
+	});
+}
+
+///
+/// \brief dispatch: run tool for type from command line
+/// \param options
+/// \return
+/// \throw UsageError for unknown type
+///
+Stats dispatch(const Options &options)
+{
+	if (options.type == "base64")
+	{
+		return run<Base64Traits>(options);
+	}
+	if (options.type == "base64url")
+	{
+		return run<Base64HexTraits>(options);
+	}
+	if (options.type == "base32")
+	{
+		return run<Base32Traits>(options);
+	}
+	if (options.type == "base32hex")
+	{
+		return run<Base32HexTraits>(options);
+	}
+	if (options.type == "base16")
+	{
+		return run<Base16Traits>(options);
+	}
+	throw UsageError("unknown type " + std::string(options.type));
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+	try
+	{
+		const Options options = parseOptions(argc, argv);
+
+		const auto start = std::chrono::steady_clock::now();
+		const Stats stats = dispatch(options);
+		const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+
+		if (options.stats)
+		{
+			const double seconds = std::max(time.count(), 1e-9);
+			std::fprintf(stderr, "%s %zu -> %zu bytes, %s, %zu threads, %.6f s"
+					", %.1f MB/s\n"
+					, options.decode ? "decoded" : "encoded", stats.inputSize
+					, stats.outputSize, stats.mode, options.threadCount, seconds
+					, static_cast<double>(stats.inputSize) / seconds / 1e6);
+		}
+		return EXIT_SUCCESS;
+	}
+	catch (const UsageError &error)
+	{
+		std::fprintf(stderr, "basecoder: %s\n\n%s", error.what(), usage);
+	}
+	catch (const std::exception &error)
+	{
+		std::fprintf(stderr, "basecoder: %s\n", error.what());
+	}
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,125 @@
+# round trip of binary data through mapped files and pipes for every type
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+# the tool itself is binary data with zero bytes
+set(INPUT ${BASECODER})
+
+function(check_success result what)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "${what} failed: ${result}")
+	endif()
+endfunction()
+
+function(check_same expected actual what)
+	execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${expected} ${actual}
+		RESULT_VARIABLE result)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "${what}: ${actual} differs from ${expected}")
+	endif()
+endfunction()
+
+foreach(type base64 base64url base32 base32hex base16)
+	set(encoded ${WORK_DIR}/${type}.encoded)
+
+	execute_process(COMMAND ${BASECODER} -t ${type} ${INPUT} ${encoded}
+		RESULT_VARIABLE result)
+	check_success("${result}" "${type} mapped encode")
+	execute_process(COMMAND ${BASECODER} -d -t ${type} -j 3 ${encoded} ${WORK_DIR}/${type}.mapped
+		RESULT_VARIABLE result)
+	check_success("${result}" "${type} mapped decode")
+	check_same(${INPUT} ${WORK_DIR}/${type}.mapped "${type} mapped")
+
+	execute_process(
+		COMMAND ${BASECODER} -t ${type} -j 2 ${INPUT}
+		COMMAND ${BASECODER} -t ${type} -d - ${WORK_DIR}/${type}.stream
+		OUTPUT_FILE ${WORK_DIR}/${type}.stdout
+		RESULTS_VARIABLE results)
+	check_success("${results}" "${type} stream")
+	check_same(${INPUT} ${WORK_DIR}/${type}.stream "${type} stream")
+
+	execute_process(COMMAND ${BASECODER} -t ${type}
+		INPUT_FILE ${INPUT}
+		OUTPUT_FILE ${WORK_DIR}/${type}.stdout
+		RESULT_VARIABLE result)
+	check_success("${result}" "${type} stream encode")
+	check_same(${encoded} ${WORK_DIR}/${type}.stdout "${type} stream encode")
+endforeach()
+
+file(WRITE ${WORK_DIR}/invalid "Zm9vYmFy*m9v")
+foreach(threads 1 2)
+	execute_process(COMMAND ${BASECODER} -d -j ${threads} ${WORK_DIR}/invalid ${WORK_DIR}/out
+		RESULT_VARIABLE result ERROR_VARIABLE error)
+	if(result EQUAL 0 OR NOT error MATCHES "invalid character at offset 8")
+		message(FATAL_ERROR "invalid input is accepted: ${error}")
+	endif()
+	if(EXISTS ${WORK_DIR}/out)
+		message(FATAL_ERROR "partial output of invalid input is left")
+	endif()
+	execute_process(COMMAND ${BASECODER} -d -j ${threads} - ${WORK_DIR}/out
+		INPUT_FILE ${WORK_DIR}/invalid
+		RESULT_VARIABLE result ERROR_VARIABLE error)
+	if(result EQUAL 0 OR NOT error MATCHES "invalid character at offset 8")
+		message(FATAL_ERROR "invalid input is accepted: ${error}")
+	endif()
+	if(EXISTS ${WORK_DIR}/out)
+		message(FATAL_ERROR "partial stream output of invalid input is left")
+	endif()
+	execute_process(COMMAND ${BASECODER} -d -j ${threads}
+		INPUT_FILE ${WORK_DIR}/invalid
+		OUTPUT_QUIET
+		RESULT_VARIABLE result ERROR_VARIABLE error)
+	if(result EQUAL 0 OR NOT error MATCHES "invalid character at offset 8")
+		message(FATAL_ERROR "invalid input is accepted: ${error}")
+	endif()
+endforeach()
+
+file(WRITE ${WORK_DIR}/same "foobar")
+execute_process(COMMAND ${BASECODER} ${WORK_DIR}/same ${WORK_DIR}/same
+	RESULT_VARIABLE result ERROR_VARIABLE error)
+file(READ ${WORK_DIR}/same content)
+if(result EQUAL 0 OR NOT error MATCHES "same file" OR NOT content STREQUAL "foobar")
+	message(FATAL_ERROR "same input and output is accepted: ${error}")
+endif()
+execute_process(COMMAND ${BASECODER} - ${WORK_DIR}/same
+	INPUT_FILE ${WORK_DIR}/same
+	RESULT_VARIABLE result ERROR_VARIABLE error)
+file(READ ${WORK_DIR}/same content)
+if(result EQUAL 0 OR NOT content STREQUAL "foobar")
+	message(FATAL_ERROR "same standard input and output is accepted: ${error}")
+endif()
+
+# one trailing line break of encoded input is ignored
+file(WRITE ${WORK_DIR}/lf "Zm9vYmFy\n")
+file(WRITE ${WORK_DIR}/crlf "Zm9vYmFy\r\n")
+foreach(name lf crlf)
+	execute_process(COMMAND ${BASECODER} -d
+		INPUT_FILE ${WORK_DIR}/${name}
+		OUTPUT_VARIABLE output
+		RESULT_VARIABLE result ERROR_VARIABLE error)
+	if(NOT result EQUAL 0 OR NOT output STREQUAL "foobar")
+		message(FATAL_ERROR "${name} stream decode: ${error}")
+	endif()
+	execute_process(COMMAND ${BASECODER} -d ${WORK_DIR}/${name} ${WORK_DIR}/${name}.decoded
+		RESULT_VARIABLE result ERROR_VARIABLE error)
+	file(READ ${WORK_DIR}/${name}.decoded output)
+	if(NOT result EQUAL 0 OR NOT output STREQUAL "foobar")
+		message(FATAL_ERROR "${name} mapped decode: ${error}")
+	endif()
+endforeach()
+
+# line-wrapped input, as written by base64(1) without -w0
+file(WRITE ${WORK_DIR}/wrapped "Zm9vYmFy\nZm9vYmFy\n")
+execute_process(COMMAND ${BASECODER} -d ${WORK_DIR}/wrapped ${WORK_DIR}/wrapped.decoded
+	RESULT_VARIABLE result ERROR_VARIABLE error)
+if(result EQUAL 0 OR NOT error MATCHES "line break at offset 8.*-w0")
+	message(FATAL_ERROR "wrapped input is accepted: ${error}")
+endif()
+execute_process(COMMAND ${BASECODER} -d
+	INPUT_FILE ${WORK_DIR}/wrapped
+	OUTPUT_QUIET
+	RESULT_VARIABLE result ERROR_VARIABLE error)
+if(result EQUAL 0 OR NOT error MATCHES "line break at offset 8.*-w0")
+	message(FATAL_ERROR "wrapped stream input is accepted: ${error}")
+endif()